@@ -0,0 +1,165 @@
+#include "tester.h"
+#include "vmstat.h"
+
+// ====================================================================
+// TEST_27
+// Summary: RECLAIM: Checks that dirty file-backed map pages are
+//          written back before they are reclaimed, and at exit
+// ====================================================================
+
+char *test_name = "TEST_27";
+
+#define N_PAGES 64      // pages of the mapped file
+#define EXTRA_PAGES 512 // pages asked for beyond free memory
+#define SETTLE_TICKS 50 // time for pending writeback to finish
+
+char buf[PGSIZE];
+
+// Word w of page pg as left by the given round of stores.
+uint pattern(int round, int pg, int w) { return (round << 24) | (pg << 12) | w; }
+
+void get_n_validate_vmstat(struct vmstat *vs) {
+    int ret = getvmstat(vs, sizeof(*vs));
+    if (ret != sizeof(*vs) || vs->version != VMSTAT_VERSION) {
+        printerr("getvmstat() returned %d, version %d\n", ret, vs->version);
+        failed();
+    }
+}
+
+// Where the next anonymous map goes: above the file map, so that
+// the clock hand reaches the file map first.
+uint next = MMAPBASE + N_PAGES * PGSIZE;
+
+// Map npages more anonymous memory and touch each page. Returns 0
+// on failure.
+int grow(int npages) {
+    int anon = MAP_FIXED | MAP_ANONYMOUS | MAP_SHARED;
+    if (wmap(next, npages * PGSIZE, anon, -1) != next) {
+        printerr("wmap() of %d pages failed\n", npages);
+        return 0;
+    }
+    char *arr = (char *)next;
+    for (int i = 0; i < npages; i++)
+        arr[i * PGSIZE] = i + 1;
+    next += npages * PGSIZE;
+    return 1;
+}
+
+// Pages of the file map still loaded, or -1.
+int loaded(void) {
+    struct wmapinfo info;
+    if (getwmapinfo(&info) != SUCCESS)
+        return -1;
+    for (int i = 0; i < info.total_mmaps; i++)
+        if (info.addr[i] == MMAPBASE)
+            return info.n_loaded_pages[i];
+    return -1;
+}
+
+void store(uint *arr, int round) {
+    for (int i = 0; i < N_PAGES; i++)
+        for (int w = 0; w < PGSIZE / 4; w++)
+            arr[i * PGSIZE / 4 + w] = pattern(round, i, w);
+}
+
+// Map the file, dirty it and run out of memory. The map must
+// still hold what was stored, though its pages were reclaimed.
+// Then store again and exit with the map in place. Returns 1 if
+// all went well.
+int child(int fd) {
+    int filebacked = MAP_FIXED | MAP_SHARED;
+    uint map = wmap(MMAPBASE, N_PAGES * PGSIZE, filebacked, fd);
+    if (map != MMAPBASE) {
+        printerr("wmap() returned %d\n", (int)map);
+        return 0;
+    }
+    uint *arr = (uint *)map;
+    store(arr, 1);
+
+    struct vmstat vs;
+    get_n_validate_vmstat(&vs);
+    if (!grow(vs.free + EXTRA_PAGES))
+        return 0;
+    sleep(SETTLE_TICKS);
+    int n = loaded();
+    if (n < 0 || n == N_PAGES) {
+        printerr("%d of %d map pages loaded, expected fewer\n", n, N_PAGES);
+        return 0;
+    }
+    printf(1, "INFO: %d of %d map pages reclaimed. \tOkay.\n", N_PAGES - n, N_PAGES);
+    for (int i = 0; i < N_PAGES; i++) {
+        for (int w = 0; w < PGSIZE / 4; w++) {
+            if (arr[i * PGSIZE / 4 + w] != pattern(1, i, w)) {
+                printerr("map page %d word %d is 0x%x, expected 0x%x\n", i, w,
+                         arr[i * PGSIZE / 4 + w], pattern(1, i, w));
+                return 0;
+            }
+        }
+    }
+    printf(1, "INFO: Reclaimed map pages read back. \tOkay.\n");
+
+    store(arr, 2);
+    if (!grow(EXTRA_PAGES))
+        return 0;
+    sleep(SETTLE_TICKS);
+    return 1;
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    char *filename = "reclaimfile";
+    int filelength = create_big_file(filename, N_PAGES, 'a');
+    int fd = open_file(filename, filelength);
+
+    int p[2];
+    if (pipe(p) < 0) {
+        printerr("pipe() failed\n");
+        failed();
+    }
+    int pid = fork();
+    if (pid < 0) {
+        printerr("fork() failed\n");
+        failed();
+    }
+    if (pid == 0) {
+        char c = child(fd) ? 'y' : 'n';
+        write(p[1], &c, 1);
+        exit();
+    }
+    char c = 'n';
+    read(p[0], &c, 1);
+    wait();
+    if (c != 'y') {
+        printerr("child saw its map change under memory pressure\n");
+        failed();
+    }
+    close(fd);
+
+    //
+    // The child's last stores reached the file, through writeback
+    // or at exit
+    //
+    fd = open_file(filename, filelength);
+    for (int i = 0; i < N_PAGES; i++) {
+        if (read(fd, buf, PGSIZE) != PGSIZE) {
+            printerr("read() of page %d failed\n", i);
+            failed();
+        }
+        uint *words = (uint *)buf;
+        for (int w = 0; w < PGSIZE / 4; w++) {
+            if (words[w] != pattern(2, i, w)) {
+                printerr("file page %d word %d is 0x%x, expected 0x%x\n", i, w,
+                         words[w], pattern(2, i, w));
+                failed();
+            }
+        }
+    }
+    close(fd);
+    unlink(filename);
+    printf(1, "INFO: The file holds what the child stored last. \tOkay.\n");
+
+    // test ends
+    success();
+}
@@ -0,0 +1,100 @@
+#include "tester.h"
+#include "vmstat.h"
+
+// ====================================================================
+// TEST_28
+// Summary: ZSWAP: Checks that pages of every compressibility read
+//          back the same after swapping
+// ====================================================================
+
+char *test_name = "TEST_28";
+
+#define EXTRA_PAGES 512 // pages asked for beyond free memory
+#define CHUNK_PAGES 256 // pages per sbrk() call
+
+// Word w of page pg. Pages take turns being all zero, one word
+// repeated, half random and all random: a zero token, a small and
+// a large compressed copy (which fit in one pool page together),
+// and a page that only disk will take.
+uint pattern(uint pg, uint w) {
+    uint v = (pg * (PGSIZE / 4) + w + 1) * 2654435761U;
+    v ^= v >> 15;
+    switch (pg % 4) {
+    case 0:
+        return 0;
+    case 1:
+        return pg + 1;
+    case 2:
+        return w < PGSIZE / 8 ? v : pg + 1;
+    default:
+        return v;
+    }
+}
+
+void get_n_validate_vmstat(struct vmstat *vs) {
+    int ret = getvmstat(vs, sizeof(*vs));
+    if (ret != sizeof(*vs) || vs->version != VMSTAT_VERSION) {
+        printerr("getvmstat() returned %d, version %d\n", ret, vs->version);
+        failed();
+    }
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    struct vmstat vs;
+    get_n_validate_vmstat(&vs);
+    int npages = vs.free + EXTRA_PAGES;
+
+    //
+    // Grow the heap past free memory, filling each page as it comes
+    //
+    char *heap = sbrk(0);
+    char *arr = (char *)PGROUNDUP((uint)heap);
+    if (sbrk(arr - heap) != heap) {
+        printerr("sbrk() failed to align the heap\n");
+        failed();
+    }
+    for (int pg = 0; pg < npages; pg += CHUNK_PAGES) {
+        int n = npages - pg < CHUNK_PAGES ? npages - pg : CHUNK_PAGES;
+        if (sbrk(n * PGSIZE) != arr + pg * PGSIZE) {
+            printerr("sbrk() failed at page %d of %d\n", pg, npages);
+            failed();
+        }
+        for (int i = pg; i < pg + n; i++) {
+            uint *p = (uint *)(arr + i * PGSIZE);
+            for (int w = 0; w < PGSIZE / 4; w++)
+                p[w] = pattern(i, w);
+        }
+    }
+    // va2pa() looks at the PTE without faulting the page in.
+    int out = 0;
+    for (int i = 0; i < npages; i++)
+        if ((int)va2pa((uint)arr + i * PGSIZE) == FAILED)
+            out++;
+    if (out == 0) {
+        printerr("no page of the heap was swapped out\n");
+        failed();
+    }
+    printf(1, "INFO: Filled %d pages, %d swapped out. \tOkay.\n", npages, out);
+
+    //
+    // Every page reads back, whether it came from the pool, a
+    // zero token or disk. Newest first, as in TEST_26.
+    //
+    for (int i = npages - 1; i >= 0; i--) {
+        uint *p = (uint *)(arr + i * PGSIZE);
+        for (int w = 0; w < PGSIZE / 4; w++) {
+            if (p[w] != pattern(i, w)) {
+                printerr("addr 0x%x contains 0x%x, expected 0x%x\n", (uint)&p[w], p[w],
+                         pattern(i, w));
+                failed();
+            }
+        }
+    }
+    printf(1, "INFO: All pages read back. \tOkay.\n");
+
+    // test ends
+    success();
+}
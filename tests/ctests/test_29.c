@@ -0,0 +1,86 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_29
+// Summary: WSS: Checks working-set estimates from getwssinfo
+// ====================================================================
+
+char *test_name = "TEST_29";
+
+#define N_PAGES 8
+
+void get_n_validate_wss_info(struct wssinfo *info) {
+    int ret = getwssinfo(0, info);
+    if (ret < 0) {
+        printerr("getwssinfo() returned %d\n", ret);
+        failed();
+    }
+    if (info->period <= 0 || info->wss > info->rss) {
+        printerr("period %d, wss %d, rss %d\n", info->period, info->wss, info->rss);
+        failed();
+    }
+}
+
+// sleep until just after a scan, so the next one is a full period away
+void align_to_scan(int period) {
+    while (uptime() % period != 1)
+        sleep(1);
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    struct wssinfo info;
+    get_n_validate_wss_info(&info);
+    int period = info.period;
+
+    if (getwssinfo(-1, &info) != FAILED) {
+        printerr("getwssinfo() accepted a bad pid\n");
+        failed();
+    }
+    printf(1, "INFO: getwssinfo() rejects a bad pid. \tOkay.\n");
+
+    int anon = MAP_FIXED | MAP_ANONYMOUS | MAP_SHARED;
+    uint map = wmap(MMAPBASE, N_PAGES * PGSIZE, anon, -1);
+    if (map != MMAPBASE) {
+        printerr("wmap() returned %d\n", (int)map);
+        failed();
+    }
+
+    //
+    // Touch every page, then let exactly one scan happen
+    //
+    align_to_scan(period);
+    char *arr = (char *)map;
+    for (int i = 0; i < N_PAGES; i++)
+        arr[i * PGSIZE] = i;
+    sleep(period);
+    get_n_validate_wss_info(&info);
+    if (info.hot[0] != N_PAGES || info.wss < N_PAGES) {
+        printerr("hot %d, wss %d, expected at least %d\n", info.hot[0], info.wss,
+                 N_PAGES);
+        failed();
+    }
+    printf(1, "INFO: Touched pages are in the working set. \tOkay.\n");
+
+    //
+    // Leave the map alone for a few scans
+    //
+    sleep(3 * period);
+    get_n_validate_wss_info(&info);
+    if (info.hot[0] != 0 || info.age[2] + info.age[3] < N_PAGES) {
+        printerr("hot %d, %d old pages, expected %d\n", info.hot[0],
+                 info.age[2] + info.age[3], N_PAGES);
+        failed();
+    }
+    printf(1, "INFO: Untouched pages age out. \tOkay.\n");
+
+    if (wunmap(map) < 0) {
+        printerr("wunmap() failed\n");
+        failed();
+    }
+
+    // test ends
+    success();
+}
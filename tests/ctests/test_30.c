@@ -0,0 +1,83 @@
+#include "tester.h"
+#include "vmstat.h"
+
+// ====================================================================
+// TEST_30
+// Summary: KSM: Checks merging of identical pages and split on write
+// ====================================================================
+
+char *test_name = "TEST_30";
+
+#define N_PAGES 8
+#define IDLE_TICKS 500 // long enough for pages to age and be scanned
+
+void get_n_validate_vmstat(struct vmstat *vs) {
+    int ret = getvmstat(vs, sizeof(*vs));
+    if (ret != sizeof(*vs) || vs->version != VMSTAT_VERSION) {
+        printerr("getvmstat() returned %d, version %d\n", ret, vs->version);
+        failed();
+    }
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    if (setmergeable(1) < 0) {
+        printerr("setmergeable() failed\n");
+        failed();
+    }
+
+    char *heap = sbrk((N_PAGES + 2) * PGSIZE);
+    char *arr = (char *)PGROUNDUP((uint)heap);
+    for (int i = 0; i < N_PAGES * PGSIZE; i++)
+        arr[i] = 'a' + i % PGSIZE % 7;
+
+    struct vmstat before, after;
+    get_n_validate_vmstat(&before);
+    sleep(IDLE_TICKS);
+    get_n_validate_vmstat(&after);
+
+    //
+    // Identical pages should now share one frame
+    //
+    uint pa = get_n_validate_va2pa((uint)arr);
+    for (int i = 1; i < N_PAGES; i++) {
+        uint pa2 = get_n_validate_va2pa((uint)arr + i * PGSIZE);
+        if (pa2 != pa) {
+            printerr("page %d at pa 0x%x, page 0 at pa 0x%x\n", i, pa2, pa);
+            failed();
+        }
+    }
+    printf(1, "INFO: Identical pages merged. \tOkay.\n");
+
+    // All but the first page were merged into another's frame
+    uint merged = after.event[VM_KSMMERGE] - before.event[VM_KSMMERGE];
+    if (merged < N_PAGES - 1) {
+        printerr("getvmstat() counted %d merges, expected at least %d\n", merged,
+                 N_PAGES - 1);
+        failed();
+    }
+    printf(1, "INFO: getvmstat() counted %d merges. \tOkay.\n", merged);
+
+    //
+    // Writing a merged page gives it its own frame again
+    //
+    arr[PGSIZE] = 'z';
+    if (get_n_validate_va2pa((uint)arr + PGSIZE) == pa) {
+        printerr("written page still shares pa 0x%x\n", pa);
+        failed();
+    }
+    for (int i = 0; i < N_PAGES * PGSIZE; i++) {
+        char expected = i == PGSIZE ? 'z' : 'a' + i % PGSIZE % 7;
+        if (arr[i] != expected) {
+            printerr("addr 0x%x contains %d, expected %d\n", (uint)arr + i, arr[i],
+                     expected);
+            failed();
+        }
+    }
+    printf(1, "INFO: Written page split from the merged frame. \tOkay.\n");
+
+    // test ends
+    success();
+}
@@ -0,0 +1,68 @@
+#include "tester.h"
+#include "vmstat.h"
+
+// ====================================================================
+// TEST_31
+// Summary: VMSTAT: Checks that getvmstat counts faults and unmaps
+// ====================================================================
+
+char *test_name = "TEST_31";
+
+#define N_PAGES 4
+
+void get_n_validate_vmstat(struct vmstat *vs) {
+    int ret = getvmstat(vs, sizeof(*vs));
+    if (ret != sizeof(*vs) || vs->version != VMSTAT_VERSION) {
+        printerr("getvmstat() returned %d, version %d\n", ret, vs->version);
+        failed();
+    }
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    struct vmstat before, after;
+    get_n_validate_vmstat(&before);
+    if (before.free == 0 || before.pgtable == 0) {
+        printerr("free %d, pgtable %d\n", before.free, before.pgtable);
+        failed();
+    }
+    printf(1, "INFO: getvmstat() returned version %d. \tOkay.\n", before.version);
+
+    int anon = MAP_FIXED | MAP_ANONYMOUS | MAP_SHARED;
+    uint map = wmap(MMAPBASE, N_PAGES * PGSIZE, anon, -1);
+    if (map != MMAPBASE) {
+        printerr("wmap() returned %d\n", (int)map);
+        failed();
+    }
+    char *arr = (char *)map;
+    for (int i = 0; i < N_PAGES; i++)
+        arr[i * PGSIZE] = i;
+    get_n_validate_vmstat(&after);
+    if (after.event[VM_LAZYANON] - before.event[VM_LAZYANON] < N_PAGES ||
+        after.event[VM_FAULT] - before.event[VM_FAULT] < N_PAGES ||
+        after.wmap < N_PAGES) {
+        printerr("%d anon fills, %d faults, %d wmap pages, expected %d\n",
+                 after.event[VM_LAZYANON] - before.event[VM_LAZYANON],
+                 after.event[VM_FAULT] - before.event[VM_FAULT], after.wmap, N_PAGES);
+        failed();
+    }
+    printf(1, "INFO: Faults on the map were counted. \tOkay.\n");
+
+    before = after;
+    if (wunmap(map) < 0) {
+        printerr("wunmap() failed\n");
+        failed();
+    }
+    get_n_validate_vmstat(&after);
+    if (after.event[VM_WUNMAP] - before.event[VM_WUNMAP] != N_PAGES) {
+        printerr("%d pages unmapped, expected %d\n",
+                 after.event[VM_WUNMAP] - before.event[VM_WUNMAP], N_PAGES);
+        failed();
+    }
+    printf(1, "INFO: Unmapped pages were counted. \tOkay.\n");
+
+    // test ends
+    success();
+}
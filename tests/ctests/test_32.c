@@ -0,0 +1,77 @@
+#include "tester.h"
+#include "param.h"
+
+// ====================================================================
+// TEST_32
+// Summary: PROCINFO: Checks getprocinfo's resident page counts
+// ====================================================================
+
+char *test_name = "TEST_32";
+
+#define N_PAGES 4
+
+struct procinfo procs[NPROC];
+
+void get_n_validate_self(struct procinfo *pi) {
+    int pid = getpid();
+    int n = getprocinfo(procs, NPROC);
+    if (n <= 0) {
+        printerr("getprocinfo() returned %d\n", n);
+        failed();
+    }
+    for (int i = 0; i < n; i++) {
+        if (procs[i].pid == pid) {
+            *pi = procs[i];
+            if (pi->shared + pi->private != pi->rss || pi->pgtable < 2) {
+                printerr("rss %d, shared %d, private %d, pgtable %d\n",
+                         pi->rss, pi->shared, pi->private, pi->pgtable);
+                failed();
+            }
+            return;
+        }
+    }
+    printerr("pid %d not found among %d processes\n", pid, n);
+    failed();
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    struct procinfo before, after;
+    get_n_validate_self(&before);
+    if (before.rss == 0 || before.sz < before.rss * PGSIZE) {
+        printerr("rss %d for size %d\n", before.rss, before.sz);
+        failed();
+    }
+    printf(1, "INFO: Found self with %d resident pages. \tOkay.\n", before.rss);
+
+    sbrk(N_PAGES * PGSIZE);
+    get_n_validate_self(&after);
+    if (after.rss - before.rss != N_PAGES) {
+        printerr("rss grew by %d after sbrk, expected %d\n", after.rss - before.rss, N_PAGES);
+        failed();
+    }
+    printf(1, "INFO: sbrk() pages were counted. \tOkay.\n");
+
+    int anon = MAP_FIXED | MAP_ANONYMOUS | MAP_SHARED;
+    uint map = wmap(MMAPBASE, N_PAGES * PGSIZE, anon, -1);
+    if (map != MMAPBASE) {
+        printerr("wmap() returned %d\n", (int)map);
+        failed();
+    }
+    char *arr = (char *)map;
+    for (int i = 0; i < N_PAGES - 1; i++)
+        arr[i * PGSIZE] = i;
+    before = after;
+    get_n_validate_self(&after);
+    if (after.wmap != N_PAGES - 1 || after.rss - before.rss != N_PAGES - 1) {
+        printerr("wmap %d, rss grew by %d, expected %d\n",
+                 after.wmap, after.rss - before.rss, N_PAGES - 1);
+        failed();
+    }
+    printf(1, "INFO: Touched wmap pages were counted. \tOkay.\n");
+
+    // test ends
+    success();
+}
@@ -0,0 +1,54 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_33
+// Summary: SPAWN: Checks that spawn runs a program with the given fds
+// ====================================================================
+
+char *test_name = "TEST_33";
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    int p[2];
+    if (pipe(p) < 0) {
+        printerr("pipe() failed\n");
+        failed();
+    }
+    // The child's stdout is the pipe; it gets no stdin.
+    char *argv[] = { "echo", "spawned", 0 };
+    int fds[] = { -1, p[1], 2 };
+    int pid = spawn("echo", argv, fds, 3);
+    if (pid <= 0) {
+        printerr("spawn() returned %d\n", pid);
+        failed();
+    }
+    close(p[1]);
+    printf(1, "INFO: spawn() returned pid %d. \tOkay.\n", pid);
+
+    char buf[32];
+    int n, tot = 0;
+    while (tot < sizeof(buf) - 1 && (n = read(p[0], buf + tot, sizeof(buf) - 1 - tot)) > 0)
+        tot += n;
+    buf[tot] = 0;
+    if (strcmp(buf, "spawned\n") != 0) {
+        printerr("read \"%s\" from the child\n", buf);
+        failed();
+    }
+    if (wait() != pid) {
+        printerr("wait() did not return the child\n");
+        failed();
+    }
+    printf(1, "INFO: Child wrote to the pipe and exited. \tOkay.\n");
+
+    int bad[] = { 15 };
+    if (spawn("echo", argv, bad, 1) >= 0) {
+        printerr("spawn() with a closed fd succeeded\n");
+        failed();
+    }
+    printf(1, "INFO: spawn() with a closed fd failed. \tOkay.\n");
+
+    // test ends
+    success();
+}
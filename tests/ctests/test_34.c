@@ -0,0 +1,72 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_34
+// Summary: PAGECACHE: Checks that a file map and read()/write() agree
+// ====================================================================
+
+char *test_name = "TEST_34";
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    char *filename = "pcfile.txt";
+    int filelength = create_big_file(filename, 2, 'a');
+    int fd = open_file(filename, filelength);
+
+    int filebacked = MAP_FIXED | MAP_SHARED;
+    uint map = wmap(MMAPBASE, filelength, filebacked, fd);
+    if (map != MMAPBASE) {
+        printerr("wmap() returned %d\n", (int)map);
+        failed();
+    }
+    char *arr = (char *)map;
+
+    // A store through the map is seen by read() before unmapping.
+    arr[PGSIZE + 10] = 'X';
+    char buf[16];
+    int fd2 = open_file(filename, filelength);
+    if (read(fd2, buf, 1) != 1 || buf[0] != 'a') {
+        printerr("read() of page 0 failed\n");
+        failed();
+    }
+    close(fd2);
+    fd2 = open_file(filename, filelength);
+    // No lseek: skip page 0 a chunk at a time.
+    char chunk[512];
+    for (int i = 0; i < PGSIZE / sizeof(chunk); i++) {
+        if (read(fd2, chunk, sizeof(chunk)) != sizeof(chunk)) {
+            printerr("read() of page 0 failed\n");
+            failed();
+        }
+    }
+    if (read(fd2, buf, 11) != 11 || buf[10] != 'X') {
+        printerr("read() did not see the store through the map\n");
+        failed();
+    }
+    printf(1, "INFO: read() sees stores through the map. \tOkay.\n");
+
+    // A write() is seen through the map.
+    close(fd2);
+    fd2 = open_file(filename, filelength);
+    if (write(fd2, "YZ", 2) != 2) {
+        printerr("write() failed\n");
+        failed();
+    }
+    close(fd2);
+    if (arr[0] != 'Y' || arr[1] != 'Z' || arr[2] != 'a') {
+        printerr("map holds %c%c%c after write()\n", arr[0], arr[1], arr[2]);
+        failed();
+    }
+    printf(1, "INFO: The map sees write(). \tOkay.\n");
+
+    if (wunmap(map) < 0) {
+        printerr("wunmap() failed\n");
+        failed();
+    }
+    close(fd);
+
+    // test ends
+    success();
+}
@@ -0,0 +1,89 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_35
+// Summary: BCACHE: Checks that processes writing and reading different
+//          files at once each get their own data back
+// ====================================================================
+
+char *test_name = "TEST_35";
+
+#define NCHILD 4
+#define NBLOCK 24
+
+char buf[512];
+
+void fill(int child, int block) {
+    for (int i = 0; i < sizeof(buf); i++)
+        buf[i] = 'a' + (child * 7 + block + i) % 26;
+}
+
+// Returns 1 if the file came back intact.
+int worker(int child) {
+    char name[] = "bcache0";
+    name[6] = '0' + child;
+    int fd = open(name, O_CREATE | O_RDWR);
+    if (fd < 0)
+        return 0;
+    for (int b = 0; b < NBLOCK; b++) {
+        fill(child, b);
+        if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+            return 0;
+    }
+    close(fd);
+
+    char got[sizeof(buf)];
+    if ((fd = open(name, O_RDONLY)) < 0)
+        return 0;
+    for (int b = 0; b < NBLOCK; b++) {
+        fill(child, b);
+        if (read(fd, got, sizeof(got)) != sizeof(got))
+            return 0;
+        for (int i = 0; i < sizeof(got); i++)
+            if (got[i] != buf[i])
+                return 0;
+    }
+    close(fd);
+    return unlink(name) == 0;
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    int p[2];
+    if (pipe(p) < 0) {
+        printerr("pipe() failed\n");
+        failed();
+    }
+    for (int i = 0; i < NCHILD; i++) {
+        int pid = fork();
+        if (pid < 0) {
+            printerr("fork() failed\n");
+            failed();
+        }
+        if (pid == 0) {
+            char c = worker(i) ? 'y' : 'n';
+            write(p[1], &c, 1);
+            exit();
+        }
+    }
+    close(p[1]);
+
+    int ok = 0;
+    char c;
+    while (read(p[0], &c, 1) == 1)
+        if (c == 'y')
+            ok++;
+    for (int i = 0; i < NCHILD; i++)
+        wait();
+    if (ok != NCHILD) {
+        printerr("%d of %d children got their file back\n", ok, NCHILD);
+        failed();
+    }
+    printf(1, "INFO: %d children wrote and read back %d blocks each. \tOkay.\n",
+           NCHILD, NBLOCK);
+
+    // test ends
+    success();
+}
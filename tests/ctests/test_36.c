@@ -0,0 +1,89 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_36
+// Summary: READAHEAD: Checks that a sequential reader sees a write made
+//          to the part of the file it has already read ahead
+// ====================================================================
+
+char *test_name = "TEST_36";
+
+#define FILESIZE (32 * 1024)
+#define CHUNK 512
+
+char buf[CHUNK];
+
+void fill(int gen, int off) {
+    for (int i = 0; i < CHUNK; i++)
+        buf[i] = 'a' + (gen * 11 + (off + i) / 7) % 26;
+}
+
+int check(int gen, int off) {
+    char want;
+    for (int i = 0; i < CHUNK; i++) {
+        want = 'a' + (gen * 11 + (off + i) / 7) % 26;
+        if (buf[i] != want)
+            return 0;
+    }
+    return 1;
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    char *name = "readahead";
+    int fd = open(name, O_CREATE | O_RDWR);
+    if (fd < 0) {
+        printerr("open() failed\n");
+        failed();
+    }
+    for (int off = 0; off < FILESIZE; off += CHUNK) {
+        fill(0, off);
+        if (write(fd, buf, CHUNK) != CHUNK) {
+            printerr("write() failed at %d\n", off);
+            failed();
+        }
+    }
+    close(fd);
+    printf(1, "INFO: Wrote a %d byte file. \tOkay.\n", FILESIZE);
+
+    // Read sequentially far enough to start readahead.
+    int rfd = open(name, O_RDONLY);
+    int off;
+    for (off = 0; off < 4096; off += CHUNK) {
+        if (read(rfd, buf, CHUNK) != CHUNK || !check(0, off)) {
+            printerr("first read wrong at %d\n", off);
+            failed();
+        }
+    }
+
+    // Rewrite the first half, including what is being read ahead.
+    int wfd = open(name, O_RDWR);
+    for (int w = 0; w < FILESIZE / 2; w += CHUNK) {
+        fill(1, w);
+        if (write(wfd, buf, CHUNK) != CHUNK) {
+            printerr("rewrite failed at %d\n", w);
+            failed();
+        }
+    }
+    close(wfd);
+
+    for (; off < FILESIZE; off += CHUNK) {
+        if (read(rfd, buf, CHUNK) != CHUNK ||
+            !check(off < FILESIZE / 2 ? 1 : 0, off)) {
+            printerr("read wrong data at %d\n", off);
+            failed();
+        }
+    }
+    if (read(rfd, buf, CHUNK) != 0) {
+        printerr("read past the end of the file\n");
+        failed();
+    }
+    close(rfd);
+    printf(1, "INFO: Sequential read saw the rewritten data. \tOkay.\n");
+
+    unlink(name);
+    // test ends
+    success();
+}
@@ -0,0 +1,123 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_37
+// Summary: LOG: Checks fsync() and that files stay intact while many
+//          small transactions fill the log and force checkpoints
+// ====================================================================
+
+char *test_name = "TEST_37";
+
+#define NCHILD 3
+#define NFILE 20
+
+char buf[512];
+
+void name(char *n, int child, int i) {
+    n[0] = 'g';
+    n[1] = 'c';
+    n[2] = '0' + child;
+    n[3] = 'a' + i / 10;
+    n[4] = '0' + i % 10;
+    n[5] = 0;
+}
+
+// Create, fill and remove files, then check a last batch of them.
+// Returns 1 if all went well.
+int worker(int child) {
+    char n[6];
+    int fd;
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < NFILE; i++) {
+            name(n, child, i);
+            if ((fd = open(n, O_CREATE | O_RDWR)) < 0)
+                return 0;
+            memset(buf, 'A' + (child + i + round) % 26, sizeof(buf));
+            if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+                return 0;
+            close(fd);
+        }
+        if (round == 2)
+            break;
+        for (int i = 0; i < NFILE; i++) {
+            name(n, child, i);
+            if (unlink(n) < 0)
+                return 0;
+        }
+    }
+    for (int i = 0; i < NFILE; i++) {
+        name(n, child, i);
+        if ((fd = open(n, O_RDONLY)) < 0)
+            return 0;
+        if (read(fd, buf, sizeof(buf)) != sizeof(buf) ||
+            buf[0] != 'A' + (child + i + 2) % 26 ||
+            buf[511] != buf[0])
+            return 0;
+        close(fd);
+        unlink(n);
+    }
+    return 1;
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    int fd = open("fsyncfile", O_CREATE | O_RDWR);
+    if (fd < 0) {
+        printerr("open() failed\n");
+        failed();
+    }
+    memset(buf, 'z', sizeof(buf));
+    if (write(fd, buf, sizeof(buf)) != sizeof(buf)) {
+        printerr("write() failed\n");
+        failed();
+    }
+    if (fsync(fd) != 0) {
+        printerr("fsync() failed\n");
+        failed();
+    }
+    close(fd);
+    if (fsync(fd) != -1) {
+        printerr("fsync() of a closed fd did not fail\n");
+        failed();
+    }
+    unlink("fsyncfile");
+    printf(1, "INFO: fsync() works and rejects a closed fd. \tOkay.\n");
+
+    int p[2];
+    if (pipe(p) < 0) {
+        printerr("pipe() failed\n");
+        failed();
+    }
+    for (int i = 0; i < NCHILD; i++) {
+        int pid = fork();
+        if (pid < 0) {
+            printerr("fork() failed\n");
+            failed();
+        }
+        if (pid == 0) {
+            char c = worker(i) ? 'y' : 'n';
+            write(p[1], &c, 1);
+            exit();
+        }
+    }
+    close(p[1]);
+    int ok = 0;
+    char c;
+    while (read(p[0], &c, 1) == 1)
+        if (c == 'y')
+            ok++;
+    for (int i = 0; i < NCHILD; i++)
+        wait();
+    if (ok != NCHILD) {
+        printerr("%d of %d children saw their files intact\n", ok, NCHILD);
+        failed();
+    }
+    printf(1, "INFO: %d children created and removed %d files each. \tOkay.\n",
+           NCHILD, 3 * NFILE);
+
+    // test ends
+    success();
+}
@@ -0,0 +1,105 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_38
+// Summary: LOG: Checks that large and unaligned writes, whose data is
+//          written in place rather than logged, read back correctly,
+//          also into blocks freed by an earlier file
+// ====================================================================
+
+char *test_name = "TEST_38";
+
+#define FILESIZE (64 * 1024)   // past the direct blocks
+#define CHUNK (24 * 1024 + 100)
+
+char buf[FILESIZE];
+
+char pattern(int i, int round) {
+    return 'a' + (i / 7 + i / 512 + round) % 26;
+}
+
+// Write the file in unaligned chunks. Returns 1 if all went well.
+int fill(char *name, int round) {
+    int fd, i, n;
+
+    if ((fd = open(name, O_CREATE | O_RDWR)) < 0)
+        return 0;
+    for (i = 0; i < FILESIZE; i++)
+        buf[i] = pattern(i, round);
+    for (i = 0; i < FILESIZE; i += n) {
+        n = FILESIZE - i < CHUNK ? FILESIZE - i : CHUNK;
+        if (write(fd, buf + i, n) != n)
+            return 0;
+    }
+    close(fd);
+    return 1;
+}
+
+// Read the file back, with the bytes at [lo, hi) from round2.
+int check(char *name, int round, int lo, int hi, int round2) {
+    int fd, i;
+
+    if ((fd = open(name, O_RDONLY)) < 0)
+        return 0;
+    memset(buf, 0, sizeof(buf));
+    if (read(fd, buf, FILESIZE) != FILESIZE)
+        return 0;
+    close(fd);
+    for (i = 0; i < FILESIZE; i++)
+        if (buf[i] != pattern(i, i >= lo && i < hi ? round2 : round))
+            return 0;
+    return 1;
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    if (!fill("ordered1", 0) || !check("ordered1", 0, 0, 0, 0)) {
+        printerr("large file did not read back\n");
+        failed();
+    }
+    printf(1, "INFO: wrote and read back a %d byte file. \tOkay.\n", FILESIZE);
+
+    // Overwrite an unaligned range across the indirect boundary.
+    int lo = 12 * 512 - 300, hi = 12 * 512 + 5000;
+    int fd = open("ordered1", O_RDWR);
+    if (fd < 0) {
+        printerr("open() failed\n");
+        failed();
+    }
+    for (int i = 0; i < lo; i += 1000) {
+        int n = lo - i < 1000 ? lo - i : 1000;
+        if (read(fd, buf, n) != n) {
+            printerr("read() failed\n");
+            failed();
+        }
+    }
+    for (int i = lo; i < hi; i++)
+        buf[i - lo] = pattern(i, 5);
+    if (write(fd, buf, hi - lo) != hi - lo) {
+        printerr("overwrite failed\n");
+        failed();
+    }
+    close(fd);
+    if (!check("ordered1", 0, lo, hi, 5)) {
+        printerr("overwritten file did not read back\n");
+        failed();
+    }
+    printf(1, "INFO: overwrite of bytes %d..%d read back. \tOkay.\n", lo, hi);
+
+    // The second file gets the blocks the first one had.
+    if (unlink("ordered1") < 0) {
+        printerr("unlink() failed\n");
+        failed();
+    }
+    if (!fill("ordered2", 3) || !check("ordered2", 3, 0, 0, 0)) {
+        printerr("file in reused blocks did not read back\n");
+        failed();
+    }
+    unlink("ordered2");
+    printf(1, "INFO: file in freed blocks read back. \tOkay.\n");
+
+    // test ends
+    success();
+}
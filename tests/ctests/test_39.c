@@ -0,0 +1,90 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_39
+// Summary: FS: Checks that a file larger than the direct and indirect
+//          blocks could map, held in extents, reads back correctly
+//          and that its blocks can be used again once it is removed
+// ====================================================================
+
+char *test_name = "TEST_39";
+
+#define NBLOCK 300   // past NDIRECT + NINDIRECT
+#define BLOCK 512
+
+char buf[16 * BLOCK];
+
+// Fill buf with the contents of the file from block bn on.
+void pattern(int bn, int round) {
+    for (int i = 0; i < sizeof(buf); i++)
+        buf[i] = 'A' + (bn + i / BLOCK + round) % 26;
+}
+
+int check(char *name, int round) {
+    int fd, bn;
+
+    if ((fd = open(name, O_RDONLY)) < 0)
+        return 0;
+    for (bn = 0; bn < NBLOCK; bn += 16) {
+        int n = (NBLOCK - bn < 16 ? NBLOCK - bn : 16) * BLOCK;
+        memset(buf, 0, sizeof(buf));
+        if (read(fd, buf, n) != n)
+            return 0;
+        for (int i = 0; i < n; i++)
+            if (buf[i] != 'A' + (bn + i / BLOCK + round) % 26)
+                return 0;
+    }
+    if (read(fd, buf, 1) != 0)
+        return 0;
+    close(fd);
+    return 1;
+}
+
+int fill(char *name, int round) {
+    int fd, bn;
+
+    if ((fd = open(name, O_CREATE | O_RDWR)) < 0)
+        return 0;
+    for (bn = 0; bn < NBLOCK; bn += 16) {
+        int n = (NBLOCK - bn < 16 ? NBLOCK - bn : 16) * BLOCK;
+        pattern(bn, round);
+        if (write(fd, buf, n) != n)
+            return 0;
+    }
+    close(fd);
+    return 1;
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    if (!fill("bigext", 0)) {
+        printerr("writing a %d block file failed\n", NBLOCK);
+        failed();
+    }
+    struct stat st;
+    if (stat("bigext", &st) < 0 || st.size != NBLOCK * BLOCK) {
+        printerr("file has the wrong size\n");
+        failed();
+    }
+    if (!check("bigext", 0)) {
+        printerr("%d block file did not read back\n", NBLOCK);
+        failed();
+    }
+    printf(1, "INFO: wrote and read back a %d block file. \tOkay.\n", NBLOCK);
+
+    if (unlink("bigext") < 0) {
+        printerr("unlink() failed\n");
+        failed();
+    }
+    if (!fill("bigext2", 1) || !check("bigext2", 1)) {
+        printerr("file in reused blocks did not read back\n");
+        failed();
+    }
+    unlink("bigext2");
+    printf(1, "INFO: its blocks were reused by another file. \tOkay.\n");
+
+    // test ends
+    success();
+}
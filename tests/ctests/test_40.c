@@ -0,0 +1,74 @@
+#include "tester.h"
+
+// ====================================================================
+// TEST_40
+// Summary: FS: Checks that a multi-megabyte file, whose blocks span
+//          several bitmap blocks, can be written, read back, removed
+//          and written again
+// ====================================================================
+
+char *test_name = "TEST_40";
+
+#define BLOCK 512
+#define NBLOCK 5000  // more than one bitmap block's worth
+#define CHUNK 16     // blocks per write
+
+char buf[CHUNK * BLOCK];
+
+int fill(char *name, int round) {
+    int fd, bn, n;
+
+    if ((fd = open(name, O_CREATE | O_RDWR)) < 0)
+        return 0;
+    for (bn = 0; bn < NBLOCK; bn += CHUNK) {
+        n = (NBLOCK - bn < CHUNK ? NBLOCK - bn : CHUNK) * BLOCK;
+        for (int i = 0; i < n; i++)
+            buf[i] = 'a' + (bn + i / BLOCK + round) % 26;
+        if (write(fd, buf, n) != n)
+            return 0;
+    }
+    close(fd);
+    return 1;
+}
+
+int check(char *name, int round) {
+    int fd, bn, n;
+
+    if ((fd = open(name, O_RDONLY)) < 0)
+        return 0;
+    for (bn = 0; bn < NBLOCK; bn += CHUNK) {
+        n = (NBLOCK - bn < CHUNK ? NBLOCK - bn : CHUNK) * BLOCK;
+        if (read(fd, buf, n) != n)
+            return 0;
+        for (int i = 0; i < n; i++)
+            if (buf[i] != 'a' + (bn + i / BLOCK + round) % 26)
+                return 0;
+    }
+    close(fd);
+    return 1;
+}
+
+int main() {
+    printf(1, "\n\n%s\n", test_name);
+    validate_initial_state();
+
+    for (int round = 0; round < 2; round++) {
+        if (!fill("hugefile", round)) {
+            printerr("writing %d blocks failed in round %d\n", NBLOCK, round);
+            failed();
+        }
+        if (!check("hugefile", round)) {
+            printerr("%d blocks did not read back in round %d\n", NBLOCK, round);
+            failed();
+        }
+        if (unlink("hugefile") < 0) {
+            printerr("unlink() failed\n");
+            failed();
+        }
+        printf(1, "INFO: round %d: wrote, read back and removed %d blocks. \tOkay.\n",
+               round, NBLOCK);
+    }
+
+    // test ends
+    success();
+}
@@ -279,6 +279,165 @@ class test25(Xv6Test):
     failure_pattern = "Segmentation Fault"
 
 
+class test26(Xv6Test):
+    name = "test_26"
+    description = "SWAP: heap pages filled past free memory are swapped out and read back"
+    tester = "ctests/test_26.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    timeout = 120
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+
+class test27(Xv6Test):
+    name = "test_27"
+    description = "RECLAIM: dirty file map pages are written back when reclaimed and at exit"
+    tester = "ctests/test_27.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    timeout = 120
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+
+class test28(Xv6Test):
+    name = "test_28"
+    description = "ZSWAP: zero, compressible and random pages read back the same after swapping"
+    tester = "ctests/test_28.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    timeout = 120
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+
+class test29(Xv6Test):
+    name = "test_29"
+    description = "WSS: getwssinfo reports touched pages as hot and ages idle ones"
+    tester = "ctests/test_29.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+
+class test30(Xv6Test):
+    name = "test_30"
+    description = "KSM: identical pages of a mergeable process share a frame until written"
+    tester = "ctests/test_30.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+
+class test31(Xv6Test):
+    name = "test_31"
+    description = "VMSTAT: getvmstat counts wmap faults and unmapped pages"
+    tester = "ctests/test_31.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test32(Xv6Test):
+    name = "test_32"
+    description = "PROCINFO: getprocinfo counts sbrk and wmap pages"
+    tester = "ctests/test_32.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test33(Xv6Test):
+    name = "test_33"
+    description = "SPAWN: spawn runs a program with the requested fds"
+    tester = "ctests/test_33.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test34(Xv6Test):
+    name = "test_34"
+    description = "PAGECACHE: a file map and read()/write() see the same data"
+    tester = "ctests/test_34.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test35(Xv6Test):
+    name = "test_35"
+    description = "BCACHE: concurrent writers and readers of different files see their own data"
+    tester = "ctests/test_35.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=2"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test36(Xv6Test):
+    name = "test_36"
+    description = "READAHEAD: a sequential reader sees writes to what it has read ahead"
+    tester = "ctests/test_36.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test37(Xv6Test):
+    name = "test_37"
+    description = "LOG: fsync() works and files survive many commits and checkpoints"
+    tester = "ctests/test_37.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=2"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test38(Xv6Test):
+    name = "test_38"
+    description = "LOG: file data written in place reads back, also in reused blocks"
+    tester = "ctests/test_38.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test39(Xv6Test):
+    name = "test_39"
+    description = "FS: a file mapped by extents grows past the indirect block limit"
+    tester = "ctests/test_39.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+class test40(Xv6Test):
+    name = "test_40"
+    description = "FS: a multi-megabyte file spans several bitmap blocks and reads back"
+    tester = "ctests/test_40.c"
+    header = "ctests/tester.h"
+    make_qemu_args = "CPUS=1"
+    point_value = 1
+    success_pattern = "PASSED"
+    failure_pattern = "Segmentation Fault"
+
+
 from testing.runtests import main
 
 main(
@@ -309,6 +468,21 @@ main(
         test23,
         test24,
         test25,
+        test26,
+        test27,
+        test28,
+        test29,
+        test30,
+        test31,
+        test32,
+        test33,
+        test34,
+        test35,
+        test36,
+        test37,
+        test38,
+        test39,
+        test40,
     ],
     # Add your test groups here
     # End of test groups
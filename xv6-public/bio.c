@@ -1,9 +1,11 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
+// The data of regular files is cached by pagecache.c instead and
+// only passes through here on its way to the disk.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
@@ -17,79 +19,237 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are hashed by (dev, blockno) into buckets with a lock
+// each, so lookups of different blocks do not contend. Buffers
+// nobody holds (refcnt 0) are also on an idle list, most recently
+// released first, from which misses take their victims. Lock
+// order is evict, then a bucket, then idle; only a miss, holding
+// evict, ever moves a buffer between buckets, so a buffer's
+// bucket cannot change under anyone holding a reference to it.
+//
+// The number of buffers is fixed at boot: BCACHEPCT percent of
+// the memory free then, but at least NBUF.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
-struct {
+#define NBBUCKET 128
+#define NBDIRECT (PGSIZE/BSIZE)
+
+struct bbucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+};
 
-  // Linked list of all buffers, through prev/next.
+struct {
+  struct spinlock evict;  // serializes misses
+  struct spinlock idle;   // protects the idle list
+  struct bbucket bucket[NBBUCKET];
+  int nbuf;
+  int nidle;              // buffers on the idle list
+  struct kmem_cache *direct;  // bufs for breaddirect()
+
+  // Idle buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
 } bcache;
 
+// Allocate the buffers. Runs after kinit2() so that the cache
+// can be sized to all of memory, and before the first process.
 void
 binit(void)
 {
   struct buf *b;
+  int i, npage, perpage;
+  char *mem;
 
-  initlock(&bcache.lock, "bcache");
+  initlock(&bcache.evict, "bcache");
+  initlock(&bcache.idle, "bcache.idle");
+  for(i = 0; i < NBBUCKET; i++)
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
+  bcache.direct = kmem_cache_create("bdirect", sizeof(struct buf));
+
+  perpage = PGSIZE / sizeof(struct buf);
+  npage = kfreecount() / 100 * BCACHEPCT;
+  if(npage * perpage < NBUF)
+    npage = (NBUF + perpage - 1) / perpage;
+  bcache.nbuf = npage * perpage;
 
 //PAGEBREAK!
   // Create linked list of buffers
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  for(i = 0; i < npage; i++){
+    if((mem = kalloc()) == 0)
+      panic("binit");
+    for(b = (struct buf*)mem; b < (struct buf*)mem + perpage; b++){
+      memset(b, 0, sizeof(*b));
+      b->next = bcache.head.next;
+      b->prev = &bcache.head;
+      initsleeplock(&b->lock, "buffer");
+      bcache.head.next->prev = b;
+      bcache.head.next = b;
+    }
   }
+  bcache.nidle = bcache.nbuf;
+  cprintf("bcache: %d buffers\n", bcache.nbuf);
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+static struct bbucket*
+bucketof(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev*31 + blockno) % NBBUCKET];
+}
+
+static void
+idleunlink(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  bcache.nidle--;
+}
+
+// Find the buffer for block blockno on dev in bk and take a
+// reference to it, or return 0. Caller holds bk->lock.
 static struct buf*
-bget(uint dev, uint blockno)
+lookup(struct bbucket *bk, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bk->head; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      if(b->refcnt++ == 0){
+        acquire(&bcache.idle);
+        idleunlink(b);
+        release(&bcache.idle);
+      }
       return b;
     }
   }
+  return 0;
+}
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+// Take the least recently used idle buffer out of the cache.
+// Caller holds bcache.evict.
+static struct buf*
+victim(void)
+{
+  struct bbucket *bk;
+  struct buf *b;
+
+  for(;;){
+    // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+    // because a write of it is queued.
+    acquire(&bcache.idle);
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+      if((b->flags & B_DIRTY) == 0)
+        break;
+    release(&bcache.idle);
+    if(b == &bcache.head)
+      panic("bget: no buffers");
+
+    // b's identity cannot change while we hold evict, but it
+    // may be looked up again before we get its bucket's lock.
+    bk = b->hprev ? bucketof(b->dev, b->blockno) : 0;
+    if(bk)
+      acquire(&bk->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      acquire(&bcache.idle);
+      idleunlink(b);
+      release(&bcache.idle);
+      if(bk){
+        *b->hprev = b->hnext;
+        if(b->hnext)
+          b->hnext->hprev = b->hprev;
+        b->hprev = 0;
+        release(&bk->lock);
+      }
       return b;
     }
+    if(bk)
+      release(&bk->lock);
   }
-  panic("bget: no buffers");
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return the buffer with a reference but
+// not locked.
+static struct buf*
+bref(uint dev, uint blockno)
+{
+  struct bbucket *bk;
+  struct buf *b;
+
+  bk = bucketof(dev, blockno);
+  acquire(&bk->lock);
+  b = lookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b)
+    return b;
+
+  // Not cached; recycle an idle buffer. Check again under
+  // evict, since another miss may have brought the block in.
+  acquire(&bcache.evict);
+  acquire(&bk->lock);
+  b = lookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b == 0){
+    b = victim();
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->refcnt = 1;
+    acquire(&bk->lock);
+    b->hnext = bk->head;
+    if(bk->head)
+      bk->head->hprev = &b->hnext;
+    b->hprev = &bk->head;
+    bk->head = b;
+    release(&bk->lock);
+  }
+  release(&bcache.evict);
+  return b;
+}
+
+// Drop a reference to b, making it idle if it was the last.
+static void
+bput(struct buf *b)
+{
+  struct bbucket *bk;
+
+  bk = bucketof(b->dev, b->blockno);
+  acquire(&bk->lock);
+  b->refcnt--;
+  if (b->refcnt == 0) {
+    // no one is waiting for it.
+    acquire(&bcache.idle);
+    b->next = bcache.head.next;
+    b->prev = &bcache.head;
+    bcache.head.next->prev = b;
+    bcache.head.next = b;
+    bcache.nidle++;
+    release(&bcache.idle);
+  }
+  release(&bk->lock);
+}
+
+// Return locked buffer for block on device dev.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bref(dev, blockno);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -105,6 +265,57 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Copy the n indicated blocks, at most a page's worth, into
+// data without keeping them in the cache; used for file data,
+// which pagecache.c caches. Cached copies, which may be newer
+// than the disk, win; the rest are read from the disk together,
+// into bufs of the caller's own, so that concurrent readers'
+// requests are queued together. If no buf can be had, the block
+// is read through the cache instead.
+void
+breaddirect(uint dev, uint *blockno, int n, uchar *data)
+{
+  struct bbucket *bk;
+  struct buf *b, *bv[NBDIRECT];
+  int i, nv, at[NBDIRECT];
+
+  if(n > NBDIRECT)
+    panic("breaddirect");
+  nv = 0;
+  for(i = 0; i < n; i++){
+    bk = bucketof(dev, blockno[i]);
+    acquire(&bk->lock);
+    b = lookup(bk, dev, blockno[i]);
+    release(&bk->lock);
+    if(b == 0 && (b = kmem_cache_alloc(bcache.direct)) != 0){
+      initsleeplock(&b->lock, "bdirect");
+      acquiresleep(&b->lock);
+      b->dev = dev;
+      b->blockno = blockno[i];
+      b->flags = 0;
+      at[nv] = i;
+      bv[nv++] = b;
+      continue;
+    }
+    if(b)
+      acquiresleep(&b->lock);
+    else
+      b = bget(dev, blockno[i]);
+    if((b->flags & B_VALID) == 0)
+      iderw(b);
+    memmove(data + i*BSIZE, b->data, BSIZE);
+    brelse(b);
+  }
+  if(nv > 0)
+    iderwv(bv, nv);
+  for(i = 0; i < nv; i++){
+    b = bv[i];
+    memmove(data + at[i]*BSIZE, b->data, BSIZE);
+    releasesleep(&b->lock);
+    kmem_cache_free(bcache.direct, b);
+  }
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,8 +326,36 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write the n locked bufs to disk together, as writei() does
+// with file data. They stay locked.
+void
+bwritev(struct buf **bv, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bv[i]->lock))
+      panic("bwritev");
+    bv[i]->flags |= B_DIRTY;
+  }
+  iderwv(bv, n);
+}
+
+// Return a locked buf of zeros for a block just allocated,
+// without reading its old contents from the disk.
+struct buf*
+bnew(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  memset(b->data, 0, BSIZE);
+  b->flags |= B_VALID;
+  return b;
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Move to the head of the idle list if nobody else holds it.
 void
 brelse(struct buf *b)
 {
@@ -124,21 +363,69 @@ brelse(struct buf *b)
     panic("brelse");
 
   releasesleep(&b->lock);
+  bput(b);
+}
 
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+// Keep b in the cache after it is released, as log.c does for
+// blocks of a transaction until they are installed.
+void
+bpin(struct buf *b)
+{
+  struct bbucket *bk;
+
+  bk = bucketof(b->dev, b->blockno);
+  acquire(&bk->lock);
+  b->refcnt++;
+  release(&bk->lock);
+}
+
+// Undo a bpin().
+void
+bunpin(struct buf *b)
+{
+  bput(b);
+}
+
+// Start reading the n indicated blocks, at most a page's worth,
+// into the cache without waiting for them, for readahead. Blocks
+// already cached are skipped, and so is everything once half the
+// cache is busy. The disk driver releases the buffers by calling
+// bdone() as the reads finish.
+void
+breadahead(uint dev, uint *blockno, int n)
+{
+  struct buf *b, *bv[NBDIRECT];
+  int i, nv;
+
+  if(n > NBDIRECT)
+    panic("breadahead");
+  nv = 0;
+  for(i = 0; i < n && bcache.nidle > bcache.nbuf/2; i++){
+    b = bref(dev, blockno[i]);
+    if(b->flags & B_VALID){
+      bput(b);
+      continue;
+    }
+    acquiresleep(&b->lock);
+    if(b->flags & B_VALID){
+      brelse(b);
+      continue;
+    }
+    bv[nv++] = b;
   }
-  
-  release(&bcache.lock);
+  if(nv > 0)
+    idestartv(bv, nv);
 }
+
+// Called by the disk driver when a read started by
+// breadahead() has finished.
+void
+bdone(struct buf *b)
+{
+  releasesleep(&b->lock);
+  bput(b);
+}
+
 //PAGEBREAK!
 // Blank page.
 
@@ -4,11 +4,15 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  struct buf *prev; // idle list, least recently used last
   struct buf *next;
+  struct buf *hnext; // hash chain
+  struct buf **hprev; // link to this buf in its chain, or 0
   struct buf *qnext; // disk queue
+  uint qtime; // ticks when queued
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // read started by breadahead(), not waited for
 
@@ -229,6 +229,12 @@ consoleintr(int (*getc)(void))
   release(&cons.lock);
   if(doprocdump) {
     procdump();  // now call procdump() wo. cons.lock held
+    kallocdump();
+    slabdump();
+    swapdump();
+    pcachedump();
+    idedump();
+    ksmdump();
   }
 }
 
@@ -1,20 +1,33 @@
 struct buf;
 struct context;
+struct faulthist;
 struct file;
+struct image;
 struct inode;
+struct kmem_cache;
 struct pipe;
 struct proc;
+struct procinfo;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct vmstat;
+struct wssinfo;
 
 // bio.c
+void            bdone(struct buf*);
 void            binit(void);
+void            bpin(struct buf*);
+struct buf*     bnew(uint, uint);
 struct buf*     bread(uint, uint);
+void            breadahead(uint, uint*, int);
+void            breaddirect(uint, uint*, int, uchar*);
 void            brelse(struct buf*);
+void            bunpin(struct buf*);
 void            bwrite(struct buf*);
+void            bwritev(struct buf**, int);
 
 // console.c
 void            consoleinit(void);
@@ -24,6 +37,7 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             loadimage(char*, char**, struct image*);
 
 // file.c
 struct file*    filealloc(void);
@@ -31,8 +45,10 @@ void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+char*           filepage(struct file*, uint);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewriteat(struct file*, char*, int n, uint off);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -41,6 +57,7 @@ struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
+void            bmapinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
@@ -49,14 +66,19 @@ void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
+void            readahead(struct inode*, uint, uint);
 int             readi(struct inode*, char*, uint, uint);
+void            readipage(struct inode*, char*, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
 // ide.c
+void            idedump(void);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
+void            idestartv(struct buf**, int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -65,9 +87,18 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+int             kalloc_bulk(char**, int);
+char*           kalloc_pages(int);
+char*           kalloc_zeroed(void);
+int             kalloc_zeroed_bulk(char**, int);
+void            kallocdump(void);
+int             kfreecount(void);
 void            kfree(char*);
+void            kfree_bulk(char**, int);
+void            kfree_pages(char*, int);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kzeroidle(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -81,11 +112,20 @@ void            lapicinit(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
+// ksm.c
+void            ksmdump(void);
+void            ksminit(void);
+void            ksmscan(void);
+
 // log.c
 void            initlog(int dev);
+int             log_busy(uint);
+void            log_drain(void);
+void            log_free(uint);
 void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
+void            logsync(void);
 
 // mp.c
 extern int      ismp;
@@ -95,9 +135,25 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pagecache.c
+int             pcachedrop(struct inode*, uint);
+void            pcachedump(void);
+char*           pcacheget(struct inode*, uint, int);
+int             pcachehas(struct inode*, uint);
+void            pcacheinit(void);
+void            pcacheinval(struct inode*);
+int             pcacheshrink(int);
+void            pcachewrite(struct inode*, uint, char*, uint);
+
+// pci.c
+uint            pciconfread(uint, int);
+void            pciconfwrite(uint, int, uint);
+int             pcifind(int, int, uint*);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
+void            pipeinit(void);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
 
@@ -106,21 +162,40 @@ int             pipewrite(struct pipe*, char*, int);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             spawn(char*, char**, int*, int);
+int             getwss(int, struct wssinfo*);
+int             getprocinfo(struct procinfo*, int);
 int             growproc(int);
 int             kill(int);
+int             kthread(char*, void(*)(void));
+void            lockptable(void);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
+struct proc*    procslot(int);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+void            unlockptable(void);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
 
+// swap.c
+char*           kalloc_reclaim(int);
+int             reclaim(int, int);
+void            reclaimlow(void);
+void            swapdump(void);
+void            swapdup(uint);
+void            swapfree(uint);
+int             swapin(pde_t*, uint);
+void            swapinit(int);
+int             swapinrange(pde_t*, uint, uint);
+int             swappable(struct proc*);
+
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -133,6 +208,12 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// slab.c
+void*           kmem_cache_alloc(struct kmem_cache*);
+struct kmem_cache* kmem_cache_create(char*, uint);
+void            kmem_cache_free(struct kmem_cache*, void*);
+void            slabdump(void);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -177,6 +258,7 @@ pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+int             residentuvm(pde_t*, uint, uint, int*);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint, int);
@@ -186,5 +268,22 @@ void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
 
+// vmcount.c
+void            faulttime(int, uint);
+void            getfaulthist(struct faulthist*, int);
+void            getvmstat(struct vmstat*);
+void            vmcount(int, int);
+
+// wss.c
+int             agepage(uint*);
+void            wssscan(void);
+
+// zswap.c
+void            zswapdrop(uint);
+void            zswapdump(void);
+void            zswapinit(void);
+int             zswapload(uint, char*);
+int             zswapstore(uint, char*);
+
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,1190 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 00 10 00 00       	push   $0x1000
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 02 10 00 00       	push   $0x1002
+  3e:	6a 01                	push   $0x1
+  40:	e8 0b 04 00 00       	call   450 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 07 10 00 00       	push   $0x1007
+  55:	50                   	push   %eax
+  56:	68 02 10 00 00       	push   $0x1002
+  5b:	6a 01                	push   $0x1
+  5d:	e8 ee 03 00 00       	call   450 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 49 02 00 00       	call   2b3 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 1e 01 00 00       	call   2cb <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 f1 00 00 00       	call   2f3 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 f4 00 00 00       	call   30b <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 ba 00 00 00       	call   2db <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+
+000002ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <exit>:
+SYSCALL(exit)
+ 2b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <wait>:
+SYSCALL(wait)
+ 2bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <pipe>:
+SYSCALL(pipe)
+ 2c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <read>:
+SYSCALL(read)
+ 2cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <write>:
+SYSCALL(write)
+ 2d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <close>:
+SYSCALL(close)
+ 2db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <kill>:
+SYSCALL(kill)
+ 2e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <exec>:
+SYSCALL(exec)
+ 2eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <open>:
+SYSCALL(open)
+ 2f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <mknod>:
+SYSCALL(mknod)
+ 2fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <unlink>:
+SYSCALL(unlink)
+ 303:	b8 12 00 00 00       	mov    $0x12,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <fstat>:
+SYSCALL(fstat)
+ 30b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <link>:
+SYSCALL(link)
+ 313:	b8 13 00 00 00       	mov    $0x13,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mkdir>:
+SYSCALL(mkdir)
+ 31b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <chdir>:
+SYSCALL(chdir)
+ 323:	b8 09 00 00 00       	mov    $0x9,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <dup>:
+SYSCALL(dup)
+ 32b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getpid>:
+SYSCALL(getpid)
+ 333:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <sbrk>:
+SYSCALL(sbrk)
+ 33b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <sleep>:
+SYSCALL(sleep)
+ 343:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <uptime>:
+SYSCALL(uptime)
+ 34b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <wmap>:
+SYSCALL(wmap)
+ 353:	b8 16 00 00 00       	mov    $0x16,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <wunmap>:
+SYSCALL(wunmap)
+ 35b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <va2pa>:
+SYSCALL(va2pa)
+ 363:	b8 18 00 00 00       	mov    $0x18,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 36b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getwssinfo>:
+SYSCALL(getwssinfo)
+ 373:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <setmergeable>:
+SYSCALL(setmergeable)
+ 37b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getvmstat>:
+SYSCALL(getvmstat)
+ 383:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <getfaulthist>:
+SYSCALL(getfaulthist)
+ 38b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <getprocinfo>:
+SYSCALL(getprocinfo)
+ 393:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <spawn>:
+SYSCALL(spawn)
+ 39b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <fsync>:
+SYSCALL(fsync)
+ 3a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+ 3ab:	66 90                	xchg   %ax,%ax
+ 3ad:	66 90                	xchg   %ax,%ax
+ 3af:	90                   	nop
+
+000003b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	53                   	push   %ebx
+ 3b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3b8:	89 d1                	mov    %edx,%ecx
+{
+ 3ba:	83 ec 3c             	sub    $0x3c,%esp
+ 3bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3c0:	85 d2                	test   %edx,%edx
+ 3c2:	0f 89 80 00 00 00    	jns    448 <printint+0x98>
+ 3c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3cc:	74 7a                	je     448 <printint+0x98>
+    x = -xx;
+ 3ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3d8:	31 f6                	xor    %esi,%esi
+ 3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3e0:	89 c8                	mov    %ecx,%eax
+ 3e2:	31 d2                	xor    %edx,%edx
+ 3e4:	89 f7                	mov    %esi,%edi
+ 3e6:	f7 f3                	div    %ebx
+ 3e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3eb:	0f b6 92 68 10 00 00 	movzbl 0x1068(%edx),%edx
+ 3f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 3f6:	89 ca                	mov    %ecx,%edx
+ 3f8:	89 c1                	mov    %eax,%ecx
+ 3fa:	39 da                	cmp    %ebx,%edx
+ 3fc:	73 e2                	jae    3e0 <printint+0x30>
+  if(neg)
+ 3fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 401:	85 c0                	test   %eax,%eax
+ 403:	74 07                	je     40c <printint+0x5c>
+    buf[i++] = '-';
+ 405:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 40a:	89 f7                	mov    %esi,%edi
+ 40c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 40f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 412:	01 df                	add    %ebx,%edi
+ 414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 418:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 41b:	83 ec 04             	sub    $0x4,%esp
+ 41e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 421:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 424:	6a 01                	push   $0x1
+ 426:	50                   	push   %eax
+ 427:	56                   	push   %esi
+ 428:	e8 a6 fe ff ff       	call   2d3 <write>
+  while(--i >= 0)
+ 42d:	89 f8                	mov    %edi,%eax
+ 42f:	83 c4 10             	add    $0x10,%esp
+ 432:	83 ef 01             	sub    $0x1,%edi
+ 435:	39 d8                	cmp    %ebx,%eax
+ 437:	75 df                	jne    418 <printint+0x68>
+}
+ 439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43c:	5b                   	pop    %ebx
+ 43d:	5e                   	pop    %esi
+ 43e:	5f                   	pop    %edi
+ 43f:	5d                   	pop    %ebp
+ 440:	c3                   	ret
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 448:	31 c0                	xor    %eax,%eax
+ 44a:	eb 89                	jmp    3d5 <printint+0x25>
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 459:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 45c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 45f:	0f b6 1e             	movzbl (%esi),%ebx
+ 462:	83 c6 01             	add    $0x1,%esi
+ 465:	84 db                	test   %bl,%bl
+ 467:	74 67                	je     4d0 <printf+0x80>
+ 469:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 46c:	31 d2                	xor    %edx,%edx
+ 46e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 471:	eb 34                	jmp    4a7 <printf+0x57>
+ 473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 477:	90                   	nop
+ 478:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 47b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 480:	83 f8 25             	cmp    $0x25,%eax
+ 483:	74 18                	je     49d <printf+0x4d>
+  write(fd, &c, 1);
+ 485:	83 ec 04             	sub    $0x4,%esp
+ 488:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 48b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 48e:	6a 01                	push   $0x1
+ 490:	50                   	push   %eax
+ 491:	57                   	push   %edi
+ 492:	e8 3c fe ff ff       	call   2d3 <write>
+ 497:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 49a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 49d:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a0:	83 c6 01             	add    $0x1,%esi
+ 4a3:	84 db                	test   %bl,%bl
+ 4a5:	74 29                	je     4d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4aa:	85 d2                	test   %edx,%edx
+ 4ac:	74 ca                	je     478 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ae:	83 fa 25             	cmp    $0x25,%edx
+ 4b1:	75 ea                	jne    49d <printf+0x4d>
+      if(c == 'd'){
+ 4b3:	83 f8 25             	cmp    $0x25,%eax
+ 4b6:	0f 84 24 01 00 00    	je     5e0 <printf+0x190>
+ 4bc:	83 e8 63             	sub    $0x63,%eax
+ 4bf:	83 f8 15             	cmp    $0x15,%eax
+ 4c2:	77 1c                	ja     4e0 <printf+0x90>
+ 4c4:	ff 24 85 10 10 00 00 	jmp    *0x1010(,%eax,4)
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4d3:	5b                   	pop    %ebx
+ 4d4:	5e                   	pop    %esi
+ 4d5:	5f                   	pop    %edi
+ 4d6:	5d                   	pop    %ebp
+ 4d7:	c3                   	ret
+ 4d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+  write(fd, &c, 1);
+ 4e0:	83 ec 04             	sub    $0x4,%esp
+ 4e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4ea:	6a 01                	push   $0x1
+ 4ec:	52                   	push   %edx
+ 4ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 4f0:	57                   	push   %edi
+ 4f1:	e8 dd fd ff ff       	call   2d3 <write>
+ 4f6:	83 c4 0c             	add    $0xc,%esp
+ 4f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4fc:	6a 01                	push   $0x1
+ 4fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 501:	52                   	push   %edx
+ 502:	57                   	push   %edi
+ 503:	e8 cb fd ff ff       	call   2d3 <write>
+        putc(fd, c);
+ 508:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 50b:	31 d2                	xor    %edx,%edx
+ 50d:	eb 8e                	jmp    49d <printf+0x4d>
+ 50f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 510:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 513:	83 ec 0c             	sub    $0xc,%esp
+ 516:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 51b:	8b 13                	mov    (%ebx),%edx
+ 51d:	6a 00                	push   $0x0
+ 51f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 521:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 524:	e8 87 fe ff ff       	call   3b0 <printint>
+        ap++;
+ 529:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 52c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 52f:	31 d2                	xor    %edx,%edx
+ 531:	e9 67 ff ff ff       	jmp    49d <printf+0x4d>
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 540:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 543:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 545:	83 c0 04             	add    $0x4,%eax
+ 548:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 54b:	85 db                	test   %ebx,%ebx
+ 54d:	0f 84 9d 00 00 00    	je     5f0 <printf+0x1a0>
+        while(*s != 0){
+ 553:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 556:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 558:	84 c0                	test   %al,%al
+ 55a:	0f 84 3d ff ff ff    	je     49d <printf+0x4d>
+ 560:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 563:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 566:	89 de                	mov    %ebx,%esi
+ 568:	89 d3                	mov    %edx,%ebx
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 576:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 579:	6a 01                	push   $0x1
+ 57b:	53                   	push   %ebx
+ 57c:	57                   	push   %edi
+ 57d:	e8 51 fd ff ff       	call   2d3 <write>
+        while(*s != 0){
+ 582:	0f b6 06             	movzbl (%esi),%eax
+ 585:	83 c4 10             	add    $0x10,%esp
+ 588:	84 c0                	test   %al,%al
+ 58a:	75 e4                	jne    570 <printf+0x120>
+      state = 0;
+ 58c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 58f:	31 d2                	xor    %edx,%edx
+ 591:	e9 07 ff ff ff       	jmp    49d <printf+0x4d>
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5ab:	8b 13                	mov    (%ebx),%edx
+ 5ad:	6a 01                	push   $0x1
+ 5af:	e9 6b ff ff ff       	jmp    51f <printf+0xcf>
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	52                   	push   %edx
+ 5cc:	57                   	push   %edi
+ 5cd:	e8 01 fd ff ff       	call   2d3 <write>
+        ap++;
+ 5d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5d8:	31 d2                	xor    %edx,%edx
+ 5da:	e9 be fe ff ff       	jmp    49d <printf+0x4d>
+ 5df:	90                   	nop
+  write(fd, &c, 1);
+ 5e0:	83 ec 04             	sub    $0x4,%esp
+ 5e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e9:	6a 01                	push   $0x1
+ 5eb:	e9 11 ff ff ff       	jmp    501 <printf+0xb1>
+ 5f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 5f5:	bb 09 10 00 00       	mov    $0x1009,%ebx
+ 5fa:	e9 61 ff ff ff       	jmp    560 <printf+0x110>
+ 5ff:	90                   	nop
+
+00000600 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 600:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 601:	a1 00 20 00 00       	mov    0x2000,%eax
+{
+ 606:	89 e5                	mov    %esp,%ebp
+ 608:	57                   	push   %edi
+ 609:	56                   	push   %esi
+ 60a:	53                   	push   %ebx
+ 60b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 60e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 618:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 61a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 61c:	39 ca                	cmp    %ecx,%edx
+ 61e:	73 30                	jae    650 <free+0x50>
+ 620:	39 c1                	cmp    %eax,%ecx
+ 622:	72 04                	jb     628 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 624:	39 c2                	cmp    %eax,%edx
+ 626:	72 f0                	jb     618 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 628:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 62b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 62e:	39 f8                	cmp    %edi,%eax
+ 630:	74 2e                	je     660 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 632:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 635:	8b 42 04             	mov    0x4(%edx),%eax
+ 638:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 63b:	39 f1                	cmp    %esi,%ecx
+ 63d:	74 38                	je     677 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 63f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 641:	5b                   	pop    %ebx
+  freep = p;
+ 642:	89 15 00 20 00 00    	mov    %edx,0x2000
+}
+ 648:	5e                   	pop    %esi
+ 649:	5f                   	pop    %edi
+ 64a:	5d                   	pop    %ebp
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 650:	39 c1                	cmp    %eax,%ecx
+ 652:	72 d0                	jb     624 <free+0x24>
+ 654:	eb c2                	jmp    618 <free+0x18>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 660:	03 70 04             	add    0x4(%eax),%esi
+ 663:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 666:	8b 02                	mov    (%edx),%eax
+ 668:	8b 00                	mov    (%eax),%eax
+ 66a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 66d:	8b 42 04             	mov    0x4(%edx),%eax
+ 670:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 673:	39 f1                	cmp    %esi,%ecx
+ 675:	75 c8                	jne    63f <free+0x3f>
+    p->s.size += bp->s.size;
+ 677:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 67a:	89 15 00 20 00 00    	mov    %edx,0x2000
+    p->s.size += bp->s.size;
+ 680:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 683:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 686:	89 0a                	mov    %ecx,(%edx)
+}
+ 688:	5b                   	pop    %ebx
+ 689:	5e                   	pop    %esi
+ 68a:	5f                   	pop    %edi
+ 68b:	5d                   	pop    %ebp
+ 68c:	c3                   	ret
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000690 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 699:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 69c:	8b 15 00 20 00 00    	mov    0x2000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6a5:	c1 ef 03             	shr    $0x3,%edi
+ 6a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6ab:	85 d2                	test   %edx,%edx
+ 6ad:	0f 84 8d 00 00 00    	je     740 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6b8:	39 f9                	cmp    %edi,%ecx
+ 6ba:	73 64                	jae    720 <malloc+0x90>
+  if(nu < 4096)
+ 6bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6c1:	39 df                	cmp    %ebx,%edi
+ 6c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6cd:	eb 0a                	jmp    6d9 <malloc+0x49>
+ 6cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6d5:	39 f9                	cmp    %edi,%ecx
+ 6d7:	73 47                	jae    720 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6d9:	89 c2                	mov    %eax,%edx
+ 6db:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ 6e1:	75 ed                	jne    6d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	56                   	push   %esi
+ 6e7:	e8 4f fc ff ff       	call   33b <sbrk>
+  if(p == (char*)-1)
+ 6ec:	83 c4 10             	add    $0x10,%esp
+ 6ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6f2:	74 1c                	je     710 <malloc+0x80>
+  hp->s.size = nu;
+ 6f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6f7:	83 ec 0c             	sub    $0xc,%esp
+ 6fa:	83 c0 08             	add    $0x8,%eax
+ 6fd:	50                   	push   %eax
+ 6fe:	e8 fd fe ff ff       	call   600 <free>
+  return freep;
+ 703:	8b 15 00 20 00 00    	mov    0x2000,%edx
+      if((p = morecore(nunits)) == 0)
+ 709:	83 c4 10             	add    $0x10,%esp
+ 70c:	85 d2                	test   %edx,%edx
+ 70e:	75 c0                	jne    6d0 <malloc+0x40>
+        return 0;
+  }
+}
+ 710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 713:	31 c0                	xor    %eax,%eax
+}
+ 715:	5b                   	pop    %ebx
+ 716:	5e                   	pop    %esi
+ 717:	5f                   	pop    %edi
+ 718:	5d                   	pop    %ebp
+ 719:	c3                   	ret
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 720:	39 cf                	cmp    %ecx,%edi
+ 722:	74 4c                	je     770 <malloc+0xe0>
+        p->s.size -= nunits;
+ 724:	29 f9                	sub    %edi,%ecx
+ 726:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 729:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 72c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 72f:	89 15 00 20 00 00    	mov    %edx,0x2000
+}
+ 735:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 738:	83 c0 08             	add    $0x8,%eax
+}
+ 73b:	5b                   	pop    %ebx
+ 73c:	5e                   	pop    %esi
+ 73d:	5f                   	pop    %edi
+ 73e:	5d                   	pop    %ebp
+ 73f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 740:	c7 05 00 20 00 00 04 	movl   $0x2004,0x2000
+ 747:	20 00 00 
+    base.s.size = 0;
+ 74a:	b8 04 20 00 00       	mov    $0x2004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 74f:	c7 05 04 20 00 00 04 	movl   $0x2004,0x2004
+ 756:	20 00 00 
+    base.s.size = 0;
+ 759:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 760:	00 00 00 
+    if(p->s.size >= nunits){
+ 763:	e9 54 ff ff ff       	jmp    6bc <malloc+0x2c>
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 770:	8b 08                	mov    (%eax),%ecx
+ 772:	89 0a                	mov    %ecx,(%edx)
+ 774:	eb b9                	jmp    72f <malloc+0x9f>
@@ -7,8 +7,11 @@
 #include "x86.h"
 #include "elf.h"
 
+// Load the program at path into a new page table, with argv
+// pushed on its stack, for exec() and spawn(). The argument
+// strings are read from the current address space.
 int
-exec(char *path, char **argv)
+loadimage(char *path, char **argv, struct image *im)
 {
   char *s, *last;
   int i, off;
@@ -16,8 +19,7 @@ exec(char *path, char **argv)
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  pde_t *pgdir;
 
   begin_op();
 
@@ -91,16 +93,12 @@ exec(char *path, char **argv)
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
 
-  // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
-  switchuvm(curproc);
-  freevm(oldpgdir);
+  im->pgdir = pgdir;
+  im->sz = sz;
+  im->entry = elf.entry;  // main
+  im->sp = sp;
+  im->name = last;
   return 0;
 
  bad:
@@ -112,3 +110,26 @@ exec(char *path, char **argv)
   }
   return -1;
 }
+
+int
+exec(char *path, char **argv)
+{
+  struct image im;
+  pde_t *oldpgdir;
+  struct proc *curproc = myproc();
+
+  if(loadimage(path, argv, &im) < 0)
+    return -1;
+  safestrcpy(curproc->name, im.name, sizeof(curproc->name));
+
+  // Commit to the user image.
+  oldpgdir = curproc->pgdir;
+  curproc->pgdir = im.pgdir;
+  curproc->sz = im.sz;
+  curproc->rss = im.sz / PGSIZE;
+  curproc->tf->eip = im.entry;
+  curproc->tf->esp = im.sp;
+  switchuvm(curproc);
+  freevm(oldpgdir);
+  return 0;
+}
@@ -0,0 +1,68 @@
+// Print page fault latency percentiles for each kind of fault,
+// from the kernel's power-of-two TSC histograms. Each figure is
+// the upper bound of the bucket holding that percentile, in
+// cycles. With -r, clear the histograms after reading them.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "vmstat.h"
+
+char *names[NFAULTCLASS] = {
+[FAULT_COW]    "cow",
+[FAULT_ANON]   "anon",
+[FAULT_FILE]   "file",
+[FAULT_SWAPIN] "swapin",
+};
+
+// Print the bucket holding the q/1000'th quantile of n faults.
+void
+quantile(uint *count, uint n, uint q)
+{
+  uint want, sum;
+  int b;
+
+  want = (n * q + 999) / 1000;
+  sum = 0;
+  for(b = 0; b < NFAULTBUCKET; b++){
+    sum += count[b];
+    if(sum >= want)
+      break;
+  }
+  if(b >= 30)  // bound doesn't fit printf's %d
+    printf(1, "\t>=2^%d", b);
+  else
+    printf(1, "\t<%d", 1 << (b+1));
+}
+
+int
+main(int argc, char **argv)
+{
+  struct faulthist fh;
+  uint n;
+  int i, b, reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if(argc > 2 || (argc == 2 && !reset)){
+    printf(2, "usage: faultlat [-r]\n");
+    exit();
+  }
+  if(getfaulthist(&fh, reset) < 0){
+    printf(2, "faultlat: getfaulthist failed\n");
+    exit();
+  }
+  printf(1, "type\tcount\tp50\tp99\tp999\n");
+  for(i = 0; i < NFAULTCLASS; i++){
+    n = 0;
+    for(b = 0; b < NFAULTBUCKET; b++)
+      n += fh.count[i][b];
+    printf(1, "%s\t%d", names[i], n);
+    if(n > 0){
+      quantile(fh.count[i], n, 500);
+      quantile(fh.count[i], n, 990);
+      quantile(fh.count[i], n, 999);
+    }
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -3,23 +3,33 @@
 //
 
 #include "types.h"
+#include "stat.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 
+#define RAMIN  (2*PGSIZE)   // first readahead window
+#define RAMAX  (32*PGSIZE)  // largest readahead window
+#define WRITEMAX (64*BSIZE) // bytes written per transaction
+
 struct devsw devsw[NDEV];
+// File structures come from a slab cache; ftable.lock
+// protects their reference counts and the NFILE limit.
 struct {
   struct spinlock lock;
-  struct file file[NFILE];
+  struct kmem_cache *cache;
+  int nfile;  // file structures allocated
 } ftable;
 
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  ftable.cache = kmem_cache_create("file", sizeof(struct file));
 }
 
 // Allocate a file structure.
@@ -29,15 +39,22 @@ filealloc(void)
   struct file *f;
 
   acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
+  if(ftable.nfile >= NFILE){
+    release(&ftable.lock);
+    return 0;
   }
+  ftable.nfile++;
   release(&ftable.lock);
-  return 0;
+
+  if((f = kmem_cache_alloc(ftable.cache)) == 0){
+    acquire(&ftable.lock);
+    ftable.nfile--;
+    release(&ftable.lock);
+    return 0;
+  }
+  memset(f, 0, sizeof(*f));
+  f->ref = 1;
+  return f;
 }
 
 // Increment ref count for file f.
@@ -68,7 +85,9 @@ fileclose(struct file *f)
   ff = *f;
   f->ref = 0;
   f->type = FD_NONE;
+  ftable.nfile--;
   release(&ftable.lock);
+  kmem_cache_free(ftable.cache, f);
 
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
@@ -92,6 +111,32 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
+// f has just read n bytes at off. If the reads are sequential,
+// keep the data for a window past them on its way in, doubling
+// the window while the pattern lasts. Caller holds f->ip->lock.
+static void
+fileahead(struct file *f, uint off, uint n)
+{
+  uint start, end;
+
+  if(off != f->ranext){
+    f->rawin = 0;
+    f->raend = 0;
+    f->ranext = off + n;
+    return;
+  }
+  f->ranext = off + n;
+  f->rawin = f->rawin ? f->rawin*2 : RAMIN;
+  if(f->rawin > RAMAX)
+    f->rawin = RAMAX;
+  start = f->raend > off + n ? f->raend : off + n;
+  end = off + n + f->rawin;
+  if(start < end){
+    readahead(f->ip, start, end - start);
+    f->raend = end;
+  }
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
@@ -104,8 +149,11 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    if((r = readi(f->ip, addr, f->off, n)) > 0){
+      if(f->ip->type == T_FILE)
+        fileahead(f, f->off, r);
       f->off += r;
+    }
     iunlock(f->ip);
     return r;
   }
@@ -124,13 +172,13 @@ filewrite(struct file *f, char *addr, int n)
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // write a chunk at a time to avoid exceeding the
+    // maximum log transaction size. file data is not
+    // logged (see writei), so a chunk only logs the
+    // i-node, indirect block, and allocation blocks.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = WRITEMAX;
     int i = 0;
     while(i < n){
       int n1 = n - i;
@@ -146,12 +194,62 @@ filewrite(struct file *f, char *addr, int n)
 
       if(r < 0)
         break;
-      if(r != n1)
-        panic("short filewrite");
       i += r;
+      if(r != n1)
+        break;  // the file cannot grow
     }
     return i == n ? n : -1;
   }
   panic("filewrite");
 }
 
+// Write n bytes at offset off of file f, leaving f->off alone
+// and stopping at the end of the file. Used to write back
+// pages of file mappings. Returns the number of bytes written.
+int
+filewriteat(struct file *f, char *addr, int n, uint off)
+{
+  int r, i, n1;
+  int max = WRITEMAX;
+
+  if(f->writable == 0 || f->type != FD_INODE)
+    return -1;
+  for(i = 0; i < n; i += r){
+    n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op();
+    ilock(f->ip);
+    r = 0;
+    if(off + i < f->ip->size){
+      if(n1 > f->ip->size - off - i)
+        n1 = f->ip->size - off - i;
+      r = writei(f->ip, addr + i, off + i, n1);
+    }
+    iunlock(f->ip);
+    end_op();
+
+    if(r < 0)
+      return -1;
+    if(r == 0)
+      break;
+  }
+  return i;
+}
+
+// Return the page-cache frame holding the page of f at off,
+// which is page-aligned, with a reference for the caller to map
+// into a shared file mapping; or 0 if memory is short.
+char*
+filepage(struct file *f, uint off)
+{
+  char *mem;
+
+  if(f->type != FD_INODE)
+    return 0;
+  ilock(f->ip);
+  mem = f->ip->type == T_FILE ? pcacheget(f->ip, off/PGSIZE, 0) : 0;
+  iunlock(f->ip);
+  return mem;
+}
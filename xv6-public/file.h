@@ -6,6 +6,9 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint ranext;  // offset a sequential read would start at
+  uint raend;   // end of the readahead already started
+  uint rawin;   // readahead window, 0 if reads are not sequential
 };
 
 
@@ -23,6 +26,8 @@ struct inode {
   short nlink;
   uint size;
   uint addrs[NDIRECT+1];
+
+  struct cpage *pages; // cached data pages (see pagecache.c)
 };
 
 // table mapping major device number to
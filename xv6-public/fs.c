@@ -22,6 +22,7 @@
 #include "file.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
+#define NWBATCH 16   // file data blocks writei() writes together
 static void itrunc(struct inode*);
 // there should be one superblock per disk device, but we run with
 // only one device
@@ -52,29 +53,113 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+// Free-space summary, kept so that balloc() need not read every
+// bitmap block: how many blocks under each bitmap block are free,
+// and where the last allocation left off (next fit). nfree[i]
+// only changes with bitmap block i locked; balloc() reads it
+// without the lock as a hint.
+static uint *nfree;
+static uint nbmap;
+static uint nextfree;
+
+// Count the free blocks. Called once the log is recovered.
+void
+bmapinit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
-
-  bp = 0;
+  uint b, bi;
+  int order;
+
+  nbmap = (sb.size + BPB - 1) / BPB;
+  for(order = 0; (PGSIZE << order) < nbmap*sizeof(uint); order++)
+    ;
+  if((nfree = (uint*)kalloc_pages(order)) == 0)
+    panic("bmapinit");
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+    nfree[b/BPB] = 0;
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++)
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        nfree[b/BPB]++;
+    brelse(bp);
+  }
+}
+
+// Mark the first free block from goal on in use and return it,
+// as balloc() describes, or return 0 if there is none. Sets
+// *busy if free blocks were passed over for log_busy().
+static uint
+bscan(uint dev, uint goal, int *busy)
+{
+  uint i, bno, bi, lo, hi, b;
+  int m;
+  struct buf *bp;
+
+  *busy = 0;
+  if(goal == 0 || goal >= sb.size)
+    goal = nextfree < sb.size ? nextfree : 0;
+  // Bitmap block i of nbmap+1 from goal's on, which comes
+  // round again at the end for the blocks before goal.
+  for(i = 0; i <= nbmap; i++){
+    bno = (goal/BPB + i) % nbmap;
+    lo = i == 0 ? goal % BPB : 0;
+    hi = i == nbmap ? goal % BPB : BPB;
+    if(nfree[bno] == 0)
+      continue;
+    bp = bread(dev, sb.bmapstart + bno);
+    for(bi = lo; bi < hi && bno*BPB + bi < sb.size; bi++){
+      if(bi % 8 == 0 && bp->data[bi/8] == 0xff){
+        bi += 7;
+        continue;
+      }
+      b = bno*BPB + bi;
       m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
+      if((bp->data[bi/8] & m) != 0)
+        continue;
+      if(log_busy(b)){
+        *busy = 1;
+        continue;
       }
+      bp->data[bi/8] |= m;  // Mark block in use.
+      nfree[bno]--;
+      log_write(bp);
+      brelse(bp);
+      nextfree = b + 1;
+      return b;
     }
     brelse(bp);
   }
-  panic("balloc: out of blocks");
+  return 0;
+}
+
+// Allocate a zeroed disk block, the first free one from goal
+// on, so that a file growing block by block is laid out in
+// order; with no goal, from where the last allocation left off.
+// Bitmap blocks with nothing free are skipped without reading
+// them, and so are bytes of the bitmap with nothing free.
+// Blocks freed by transactions that have not committed, or
+// still in the log, are passed over (see log_busy); if nothing
+// else is free, balloc waits for the log to let go of what it
+// can and looks again. A regular file's data never goes through
+// the log (see writei), so unless logged is set the block is
+// only zeroed in the cache. Returns 0 if the disk is full.
+static uint
+balloc(uint dev, int logged, uint goal)
+{
+  uint b;
+  int busy;
+
+  if((b = bscan(dev, goal, &busy)) == 0 && busy){
+    log_drain();
+    b = bscan(dev, goal, &busy);
+  }
+  if(b == 0)
+    return 0;
+  if(logged)
+    bzero(dev, b);
+  else
+    brelse(bnew(dev, b));
+  return b;
 }
 
 // Free a disk block.
@@ -90,8 +175,10 @@ bfree(int dev, uint b)
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
+  nfree[b/BPB]++;
   log_write(bp);
   brelse(bp);
+  log_free(b);
 }
 
 // Inodes.
@@ -241,19 +328,24 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, *empty, *old;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
+  empty = old = 0;
   for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
     if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
       ip->ref++;
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+    // An unused entry may still hold the inode's cached
+    // pages, which are worth keeping.
+    if(ip->ref == 0 && ip->pages && ip->dev == dev && ip->inum == inum)
+      old = ip;
+    // Remember empty slot, preferring one without pages.
+    if(ip->ref == 0 && (empty == 0 || (empty->pages && !ip->pages)))
       empty = ip;
   }
 
@@ -261,6 +353,10 @@ iget(uint dev, uint inum)
   if(empty == 0)
     panic("iget: no inodes");
 
+  if(old)
+    empty = old;
+  else if(empty->pages)
+    pcacheinval(empty);
   ip = empty;
   ip->dev = dev;
   ip->inum = inum;
@@ -365,32 +461,127 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT]. On a file system with
+// SB_EXTENTS, ip->addrs[] hold extents instead (see fs.h).
+
+// Largest file, in blocks.
+static uint
+maxfile(void)
+{
+  return (sb.flags & SB_EXTENTS) ? sb.size : MAXFILE;
+}
+
+// bmap() for an inode mapped by extents. Files grow one block
+// at a time at the end, so a block past the mapped ones is the
+// next one; it extends the last extent if it could be allocated
+// right after it. Returns 0 if the disk is full, or a new extent
+// is needed and there is no room for it.
+static uint
+emap(struct inode *ip, uint bn)
+{
+  struct extent *ex, *last;
+  struct buf *bp;
+  uint addr, goal;
+  int i, n, dirty;
+
+  bp = 0;
+  last = 0;
+  ex = (struct extent*)ip->addrs;
+  n = NIEXTENT;
+  for(i = 0; i < n && ex[i].len > 0; i++){
+    last = &ex[i];
+    if(bn < last->lbn + last->len){
+      addr = last->pbn + bn - last->lbn;
+      if(bp)
+        brelse(bp);
+      return addr;
+    }
+    if(i == n-1 && bp == 0 && ip->addrs[NDIRECT]){
+      // Go on in the extent block.
+      bp = bread(ip->dev, ip->addrs[NDIRECT]);
+      ex = (struct extent*)bp->data;
+      n = NXEXTENT;
+      i = -1;
+    }
+  }
+  if(bn != (last ? last->lbn + last->len : 0))
+    panic("emap: hole");
+
+  goal = last ? last->pbn + last->len : 0;
+  if((addr = balloc(ip->dev, ip->type != T_FILE, goal)) == 0){
+    if(bp)
+      brelse(bp);
+    return 0;
+  }
+  if(last && addr == goal){
+    last->len++;
+    dirty = bp && i > 0;  // last is in the extent block
+  } else {
+    if(i == n && bp == 0){
+      if((ip->addrs[NDIRECT] = balloc(ip->dev, 1, 0)) == 0){
+        bfree(ip->dev, addr);
+        return 0;
+      }
+      bp = bread(ip->dev, ip->addrs[NDIRECT]);
+      ex = (struct extent*)bp->data;
+      n = NXEXTENT;
+      i = 0;
+    }
+    if(i == n){
+      brelse(bp);
+      bfree(ip->dev, addr);
+      return 0;
+    }
+    ex[i].lbn = bn;
+    ex[i].pbn = addr;
+    ex[i].len = 1;
+    dirty = bp != 0;
+  }
+  if(bp){
+    if(dirty)
+      log_write(bp);
+    brelse(bp);
+  }
+  return addr;
+}
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one, next to the
+// block before it if it can. Returns 0 if ip cannot grow, or
+// the disk is full.
 static uint
 bmap(struct inode *ip, uint bn)
 {
   uint addr, *a;
   struct buf *bp;
 
+  if(sb.flags & SB_EXTENTS)
+    return emap(ip, bn);
+
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip->dev, ip->type != T_FILE,
+                                    bn > 0 ? ip->addrs[bn-1] + 1 : 0);
     return addr;
   }
   bn -= NDIRECT;
 
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[NDIRECT]) == 0){
+      if((addr = balloc(ip->dev, 1, ip->addrs[NDIRECT-1] + 1)) == 0)
+        return 0;
+      ip->addrs[NDIRECT] = addr;
+    }
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
+      addr = balloc(ip->dev, ip->type != T_FILE,
+                    bn > 0 ? a[bn-1] + 1 : ip->addrs[NDIRECT] + 1);
+      if(addr){
+        a[bn] = addr;
+        log_write(bp);
+      }
     }
     brelse(bp);
     return addr;
@@ -399,38 +590,144 @@ bmap(struct inode *ip, uint bn)
   panic("bmap: out of range");
 }
 
+// Truncation frees blocks in batches, each committed as an FS
+// operation of its own, so that freeing a large or scattered file
+// does not log more than MAXOPBLOCKS blocks. A batch touches at
+// most TRUNCBMAP bitmap blocks, leaving room for the inode, the
+// extent or indirect block, and what the caller of iput() logged.
+#define TRUNCBMAP (MAXOPBLOCKS-4)
+
+struct truncbatch {
+  uint bmap[TRUNCBMAP];   // bitmap blocks written in this batch
+  int n;
+};
+
+// Free block b in batch t. Returns 0, freeing nothing, if b's
+// bitmap block does not fit in the batch.
+static int
+tfree(struct inode *ip, struct truncbatch *t, uint b)
+{
+  int i;
+
+  for(i = 0; i < t->n; i++)
+    if(t->bmap[i] == BBLOCK(b, sb))
+      break;
+  if(i == t->n){
+    if(t->n == TRUNCBMAP)
+      return 0;
+    t->bmap[t->n++] = BBLOCK(b, sb);
+  }
+  bfree(ip->dev, b);
+  return 1;
+}
+
+// Commit batch t and start the next one. The caller has taken
+// the freed blocks out of ip, and logged and released the extent
+// or indirect block (the commit reads it).
+static void
+tnext(struct inode *ip, struct truncbatch *t)
+{
+  iupdate(ip);
+  end_op();
+  begin_op();
+  t->n = 0;
+}
+
+// Free the blocks of extents ex[0..n), last first, as far as
+// batch t goes. Returns 1 if all were freed, or 0 if the batch
+// filled up first; ex then maps just the blocks left.
+static int
+efree(struct inode *ip, struct truncbatch *t, struct extent *ex, int n)
+{
+  int i;
+
+  for(i = n-1; i >= 0; i--){
+    while(ex[i].len > 0){
+      if(!tfree(ip, t, ex[i].pbn + ex[i].len - 1))
+        return 0;
+      ex[i].len--;
+    }
+  }
+  return 1;
+}
+
+// itrunc() for an inode mapped by extents.
+static void
+etrunc(struct inode *ip, struct truncbatch *t)
+{
+  struct buf *bp;
+  uint xb;
+  int done;
+
+  if((xb = ip->addrs[NDIRECT]) != 0){
+    do {
+      bp = bread(ip->dev, xb);
+      done = efree(ip, t, (struct extent*)bp->data, NXEXTENT);
+      log_write(bp);
+      brelse(bp);
+      if(!done)
+        tnext(ip, t);
+    } while(!done);
+    while(!tfree(ip, t, xb))
+      tnext(ip, t);
+    ip->addrs[NDIRECT] = 0;
+  }
+  while(!efree(ip, t, (struct extent*)ip->addrs, NIEXTENT))
+    tnext(ip, t);
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
 // and has no in-memory reference to it (is
 // not an open file or current directory).
+// A large file is freed over several FS operations,
+// so what the caller did before may commit first.
 static void
 itrunc(struct inode *ip)
 {
+  struct truncbatch t;
   int i, j;
   struct buf *bp;
-  uint *a;
+  uint *a, ib;
 
+  t.n = 0;
+  ip->size = 0;
+  pcacheinval(ip);
+  if(sb.flags & SB_EXTENTS){
+    etrunc(ip, &t);
+    iupdate(ip);
+    return;
+  }
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
+      while(!tfree(ip, &t, ip->addrs[i]))
+        tnext(ip, &t);
       ip->addrs[i] = 0;
     }
   }
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+  if((ib = ip->addrs[NDIRECT]) != 0){
+    bp = bread(ip->dev, ib);
     a = (uint*)bp->data;
     for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+      while(a[j] && !tfree(ip, &t, a[j])){
+        log_write(bp);
+        brelse(bp);
+        tnext(ip, &t);
+        bp = bread(ip->dev, ib);
+        a = (uint*)bp->data;
+      }
+      a[j] = 0;
     }
+    log_write(bp);
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
+    while(!tfree(ip, &t, ib))
+      tnext(ip, &t);
     ip->addrs[NDIRECT] = 0;
   }
 
-  ip->size = 0;
   iupdate(ip);
 }
 
@@ -454,6 +751,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
+  char *pg;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -467,6 +765,12 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    if(ip->type == T_FILE && (pg = pcacheget(ip, off/PGSIZE, 0)) != 0){
+      m = min(n - tot, PGSIZE - off%PGSIZE);
+      memmove(dst, pg + off%PGSIZE, m);
+      kfree(pg);
+      continue;
+    }
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
@@ -475,14 +779,74 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   return n;
 }
 
+// Read the page of ip at off, which is page-aligned, into mem
+// for the page cache, zero past the end of the file. The data
+// blocks are not kept in the buffer cache, and are read from
+// the disk together so that the driver can merge them.
+// Caller must hold ip->lock.
+void
+readipage(struct inode *ip, char *mem, uint off)
+{
+  uint n, m, bn[PGSIZE/BSIZE];
+  int nb;
+
+  n = ip->size > off ? ip->size - off : 0;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  nb = 0;
+  for(m = 0; m < n; m += BSIZE)
+    bn[nb++] = bmap(ip, (off + m)/BSIZE);
+  breaddirect(ip->dev, bn, nb, (uchar*)mem);
+  memset(mem + n, 0, PGSIZE - n);
+}
+
+// Start reading the pages of regular file ip that cover n bytes
+// at off into the buffer cache, without waiting, so that
+// readipage() finds their blocks there. Pages already cached
+// are skipped. Caller must hold ip->lock.
+void
+readahead(struct inode *ip, uint off, uint n)
+{
+  uint pg, m, end, bn[PGSIZE/BSIZE];
+  int nb;
+
+  end = off + n < ip->size ? off + n : ip->size;
+  for(pg = off/PGSIZE; pg*PGSIZE < end; pg++){
+    if(pcachehas(ip, pg))
+      continue;
+    nb = 0;
+    for(m = pg*PGSIZE; m < end && m < (pg+1)*PGSIZE; m += BSIZE)
+      bn[nb++] = bmap(ip, m/BSIZE);
+    breadahead(ip->dev, bn, nb);
+  }
+}
+
+// Write the n locked data bufs in place and release them.
+static void
+wrelse(struct buf **bv, int n)
+{
+  int i;
+
+  bwritev(bv, n);
+  for(i = 0; i < n; i++)
+    brelse(bv[i]);
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
+// A regular file's data is written in place, NWBATCH blocks at a
+// time, before the caller's transaction commits: only metadata
+// goes through the log (ordered mode), so after a crash the
+// committed i-nodes never point at blocks that were not written.
+// Directories are logged in full. Returns the number of bytes
+// written, which is short if the file could not grow.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
-  struct buf *bp;
+  uint tot, m, addr;
+  int nb;
+  struct buf *bp, *bv[NWBATCH];
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
@@ -492,22 +856,38 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(off + n > maxfile()*BSIZE)
     return -1;
 
+  nb = 0;
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    if((addr = bmap(ip, off/BSIZE)) == 0)
+      break;  // out of extents
+    bp = bread(ip->dev, addr);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
-    brelse(bp);
+    if(ip->type != T_FILE){
+      log_write(bp);
+      brelse(bp);
+      continue;
+    }
+    pcachewrite(ip, off, (char*)bp->data + off%BSIZE, m);
+    bv[nb++] = bp;
+    if(nb == NWBATCH){
+      wrelse(bv, nb);
+      nb = 0;
+    }
   }
+  if(nb > 0)
+    wrelse(bv, nb);
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  if(tot == 0 && n > 0)
+    return -1;
+  return tot;
 }
 
 //PAGEBREAK!
@@ -548,6 +928,7 @@ dirlookup(struct inode *dp, char *name, uint *poff)
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// Returns -1 if name is already there or the disk is full.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
@@ -572,7 +953,7 @@ dirlink(struct inode *dp, char *name, uint inum)
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("dirlink");
+    return -1;  // the disk is full
 
   return 0;
 }
@@ -7,7 +7,7 @@
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
-//                                          free bit map | data blocks]
+//                                  free bit map | data blocks | swap ]
 //
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
@@ -19,12 +19,32 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint swapstart;    // Block number of first swap block
+  uint nswap;        // Number of swap blocks
+  uint flags;        // SB_ flags
 };
 
+#define SB_EXTENTS 0x1  // inodes map their blocks with extents
+
 #define NDIRECT 12
 #define NINDIRECT (BSIZE / sizeof(uint))
 #define MAXFILE (NDIRECT + NINDIRECT)
 
+// On a file system with SB_EXTENTS, an inode's addrs[0..NDIRECT)
+// hold up to NIEXTENT extents instead, each mapping len blocks of
+// the file from logical block lbn on to consecutive disk blocks
+// from pbn on. They are in order and leave no holes; an extent
+// with len 0 ends the list. addrs[NDIRECT] names a block of
+// NXEXTENT more once those run out.
+struct extent {
+  uint lbn;
+  uint pbn;
+  uint len;
+};
+
+#define NIEXTENT (NDIRECT*sizeof(uint) / sizeof(struct extent))
+#define NXEXTENT (BSIZE / sizeof(struct extent))
+
 // On-disk inode structure
 struct dinode {
   short type;           // File type
@@ -1,4 +1,23 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.
+//
+// Blocks move by bus-master DMA when a PCI IDE controller with
+// bus-master registers (PIIX and compatibles) is found: the disk
+// reads or writes the buf's data itself, described by a PRD
+// table, and interrupts when done. Otherwise, or after a DMA
+// error, they move by programmed I/O through port 0x1f0.
+//
+// Waiting bufs are kept in arrival order, and a disk scheduler
+// picks the one to start next: fifo takes the oldest; clook
+// sweeps upward through block numbers and then starts over at
+// the lowest; deadline is clook except that a read waiting
+// READEXPIRE ticks or a write waiting WRITEEXPIRE ticks goes
+// first. IOSCHED in param.h chooses one at boot.
+//
+// With DMA, the picked buf and waiting bufs for the blocks right
+// after it in the same direction are sent to the disk as one
+// command of up to IDE_MAXMERGE blocks; iderwv() queues several
+// bufs at once so that a page's worth of blocks goes out in one
+// request, and idestartv() queues reads without waiting for them.
 
 #include "types.h"
 #include "defs.h"
@@ -23,16 +42,74 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// Bus-master registers of the primary channel, from BAR4.
+#define BM_CMD        0     // command
+#define BM_STATUS     2     // status
+#define BM_PRDT       4     // physical address of the PRD table
+#define BM_START      0x01  // BM_CMD: start transfer
+#define BM_READ       0x08  // BM_CMD: transfer to memory
+#define BM_ERR        0x02  // BM_STATUS: error, write 1 to clear
+#define BM_INTR       0x04  // BM_STATUS: interrupt, write 1 to clear
+#define PRD_EOT       0x8000
+
+#define IDE_MAXMERGE  32    // blocks per command
+#define IDE_MAXBLOCK  ((1<<28) / (BSIZE/SECTOR_SIZE))  // LBA28 limit
+#define READEXPIRE    50    // ticks before deadline serves a read first
+#define WRITEEXPIRE   500   // ... or a write
+
+// Physical region descriptor: one piece of a DMA transfer. A
+// piece may not cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort n;             // bytes; 0 means 64KB
+  ushort flags;
+};
+
+// idequeue points to the first of the waiting bufs, linked
+// through qnext in arrival order. ideactive points to the bufs
+// now being read/written to the disk, linked the same way.
+// You must hold idelock while manipulating either.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *ideactive;
+static uint idehead;    // block after the last one started
+
+struct iosched {
+  char *name;
+  struct buf* (*pick)(void);  // the waiting buf to start next
+};
+
+static struct buf* fifopick(void);
+static struct buf* clookpick(void);
+static struct buf* deadlinepick(void);
+
+static struct iosched ioscheds[] = {
+  { "fifo",     fifopick },
+  { "clook",    clookpick },
+  { "deadline", deadlinepick },
+};
+static struct iosched *iosched;
+
+// Statistics, for reads ([0]) and writes ([1]).
+static struct {
+  uint nreq;            // bufs done
+  uint ncmd;            // disk commands they took
+  uint wait;            // ticks between queueing and starting
+  uint maxwait;
+  uint depth;           // sum of waiting bufs seen on arrival
+  uint maxdepth;
+} iostat[2];
 
 static int havedisk1;
+static uint bmbase;     // bus-master registers, or 0 for PIO
+static struct prd prdt[2*IDE_MAXMERGE] __attribute__((aligned(16)));
+static int idenrun;     // bufs in the active command
 static void idestart(struct buf*);
+static void dmainit(void);
 
 // Wait for IDE disk to become ready.
 static int
@@ -53,6 +130,11 @@ ideinit(void)
   int i;
 
   initlock(&idelock, "ide");
+  for(i = 0; i < NELEM(ioscheds); i++)
+    if(strncmp(ioscheds[i].name, IOSCHED, 16) == 0)
+      iosched = &ioscheds[i];
+  if(iosched == 0)
+    panic("ideinit: unknown IOSCHED");
   ioapicenable(IRQ_IDE, ncpu - 1);
   idewait(0);
 
@@ -67,15 +149,164 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  dmainit();
+}
+
+// Find the IDE controller on the PCI bus and turn on bus
+// mastering. The channel stays at the legacy ports.
+static void
+dmainit(void)
+{
+  uint tag, bar;
+
+  if(pcifind(0x01, 0x01, &tag) < 0)
+    return;
+  bar = pciconfread(tag, 0x20);
+  if((bar & 1) == 0 || (bar & 0xfffc) == 0)
+    return;
+  pciconfwrite(tag, 0x04, pciconfread(tag, 0x04) | 0x05); // I/O, bus master
+  bmbase = bar & 0xfffc;
+  outb(bmbase+BM_CMD, 0);
+  outb(bmbase+BM_STATUS, BM_ERR|BM_INTR);
+  cprintf("ide: bus-master DMA at 0x%x\n", bmbase);
+}
+
+// Describe the data of n queued bufs starting at b in the PRD
+// table, splitting a buf where it crosses a 64KB boundary (only
+// possible for bufs outside the buffer cache's pages).
+static void
+prdfill(struct buf *b, int n)
+{
+  struct prd *d;
+  uint pa, m;
+
+  d = prdt;
+  for(; n > 0; n--, b = b->qnext){
+    pa = V2P(b->data);
+    m = BSIZE;
+    if((pa & 0xffff) + BSIZE > 0x10000)
+      m = 0x10000 - (pa & 0xffff);
+    d->addr = pa;
+    d->n = m;
+    d->flags = 0;
+    d++;
+    if(m < BSIZE){
+      d->addr = pa + m;
+      d->n = BSIZE - m;
+      d->flags = 0;
+      d++;
+    }
+  }
+  d[-1].flags = PRD_EOT;
+}
+
+// Can b2, queued right after b1, go in the same command?
+static int
+adjacent(struct buf *b1, struct buf *b2)
+{
+  return b2->dev == b1->dev && b2->blockno == b1->blockno + 1 &&
+         (b2->flags & B_DIRTY) == (b1->flags & B_DIRTY);
+}
+
+static struct buf*
+fifopick(void)
+{
+  return idequeue;
+}
+
+// The waiting buf with the lowest block at or above idehead,
+// else the lowest.
+static struct buf*
+clookpick(void)
+{
+  struct buf *b, *next, *low;
+
+  next = low = 0;
+  for(b = idequeue; b; b = b->qnext){
+    if(b->blockno >= idehead && (next == 0 || b->blockno < next->blockno))
+      next = b;
+    if(low == 0 || b->blockno < low->blockno)
+      low = b;
+  }
+  return next ? next : low;
+}
+
+// The oldest expired read, else the oldest expired write,
+// else as clook.
+static struct buf*
+deadlinepick(void)
+{
+  struct buf *b;
+
+  for(b = idequeue; b; b = b->qnext)
+    if(!(b->flags & B_DIRTY) && ticks - b->qtime >= READEXPIRE)
+      return b;
+  for(b = idequeue; b; b = b->qnext)
+    if((b->flags & B_DIRTY) && ticks - b->qtime >= WRITEEXPIRE)
+      return b;
+  return clookpick();
+}
+
+// Take b off idequeue.
+static void
+dequeue(struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &idequeue; *pp != b; pp = &(*pp)->qnext)
+    if(*pp == 0)
+      panic("dequeue");
+  *pp = b->qnext;
+  b->qnext = 0;
+}
+
+// If the disk is idle, start the waiting buf the scheduler
+// picks, with DMA together with the waiting bufs that can be
+// merged after it. Caller must hold idelock.
+static void
+idedispatch(void)
+{
+  struct buf *b, *q;
+  uint wait;
+  int rw;
+
+  if(ideactive || idequeue == 0)
+    return;
+  ideactive = b = iosched->pick();
+  dequeue(b);
+  idenrun = 1;
+  while(bmbase && idenrun < IDE_MAXMERGE){
+    for(q = idequeue; q && !adjacent(b, q); q = q->qnext)
+      ;
+    if(q == 0)
+      break;
+    dequeue(q);
+    b->qnext = q;
+    b = q;
+    idenrun++;
+  }
+  idehead = b->blockno + 1;
+
+  rw = (ideactive->flags & B_DIRTY) != 0;
+  iostat[rw].ncmd++;
+  for(q = ideactive; q; q = q->qnext){
+    wait = ticks - q->qtime;
+    iostat[rw].wait += wait;
+    if(wait > iostat[rw].maxwait)
+      iostat[rw].maxwait = wait;
+  }
+  idestart(ideactive);
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for the idenrun bufs at ideactive.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(b->blockno + idenrun > IDE_MAXBLOCK)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
@@ -86,12 +317,19 @@ idestart(struct buf *b)
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, sector_per_block*idenrun);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase){
+    prdfill(b, idenrun);
+    outl(bmbase+BM_PRDT, V2P(prdt));
+    outb(bmbase+BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+    outb(bmbase+BM_STATUS, BM_ERR|BM_INTR);
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(bmbase+BM_CMD, inb(bmbase+BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
     outsl(0x1f0, b->data, BSIZE/4);
   } else {
@@ -103,29 +341,60 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *q;
+  uchar st;
 
-  // First queued buffer is the active request.
+  // ideactive is the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = ideactive) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(bmbase){
+    // Stop the engine and acknowledge the interrupt. On an
+    // error, give up on DMA and redo the request with PIO.
+    st = inb(bmbase+BM_STATUS);
+    outb(bmbase+BM_CMD, 0);
+    outb(bmbase+BM_STATUS, BM_ERR|BM_INTR);
+    if(idewait(1) < 0 || (st & BM_ERR)){
+      cprintf("ide: DMA error, status 0x%x; using PIO\n", st);
+      bmbase = 0;
+      // PIO moves one buf per command; the rest wait again.
+      while(b->qnext){
+        q = b->qnext;
+        b->qnext = q->qnext;
+        q->qnext = idequeue;
+        idequeue = q;
+      }
+      idenrun = 1;
+      idestart(b);
+      release(&idelock);
+      return;
+    }
+  } else {
+    // Read data if needed.
+    if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+      insl(0x1f0, b->data, BSIZE/4);
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for the bufs of the command.
+  iostat[(b->flags & B_DIRTY) != 0].nreq += idenrun;
+  ideactive = 0;
+  for(; b; b = q){
+    q = b->qnext;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      bdone(b);
+    } else
+      wakeup(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  // Start disk on next buf.
+  idedispatch();
 
   release(&idelock);
 }
@@ -137,32 +406,98 @@ ideintr(void)
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
+  iderwv(&b, 1);
+}
 
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+// Append n bufs to idequeue and start the disk if it is idle.
+// Caller must hold idelock.
+static void
+ideenqueue(struct buf **bv, int n)
+{
+  struct buf **pp;
+  int i, depth, rw;
 
-  acquire(&idelock);  //DOC:acquire-lock
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bv[i]->lock))
+      panic("iderw: buf not locked");
+    if((bv[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("iderw: nothing to do");
+    if(bv[i]->dev != 0 && !havedisk1)
+      panic("iderw: ide disk 1 not present");
+  }
 
-  // Append b to idequeue.
-  b->qnext = 0;
+  // Append the bufs to idequeue.
+  depth = 0;
   for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+    depth++;
+  rw = (bv[0]->flags & B_DIRTY) != 0;
+  for(i = 0; i < n; i++){
+    bv[i]->qnext = 0;
+    bv[i]->qtime = ticks;
+    *pp = bv[i];
+    pp = &bv[i]->qnext;
+    iostat[rw].depth += depth + i;
+  }
+  if(depth + n - 1 > iostat[rw].maxdepth)
+    iostat[rw].maxdepth = depth + n - 1;
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  idedispatch();
+}
+
+// Sync n bufs with disk as iderw() does, queueing them together
+// so that runs of consecutive blocks can be merged.
+void
+iderwv(struct buf **bv, int n)
+{
+  int i;
+
+  acquire(&idelock);  //DOC:acquire-lock
+  ideenqueue(bv, n);
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
+  // Wait for the requests to finish.
+  for(i = 0; i < n; i++){
+    while((bv[i]->flags & (B_VALID|B_DIRTY)) != B_VALID){
+      sleep(bv[i], &idelock);
+    }
   }
 
+  release(&idelock);
+}
 
+// Queue n locked bufs to be read like iderwv(), but without
+// waiting: each is handed to bdone() when its read is done.
+void
+idestartv(struct buf **bv, int n)
+{
+  int i;
+
+  acquire(&idelock);
+  for(i = 0; i < n; i++){
+    if(bv[i]->flags & B_DIRTY)
+      panic("idestartv");
+    bv[i]->flags |= B_ASYNC;
+  }
+  ideenqueue(bv, n);
   release(&idelock);
 }
+
+// Print disk queue statistics. Runs on ^P; no lock to avoid
+// wedging a stuck machine further.
+void
+idedump(void)
+{
+  static char *rw[] = { "reads", "writes" };
+  int i;
+
+  cprintf("ide: %s scheduler, %s\n", iosched->name, bmbase ? "dma" : "pio");
+  for(i = 0; i < 2; i++){
+    if(iostat[i].nreq == 0)
+      continue;
+    cprintf("ide: %d %s in %d commands, wait %d avg %d max ticks, "
+            "%d avg %d max queued ahead\n",
+            iostat[i].nreq, rw[i], iostat[i].ncmd,
+            iostat[i].wait / iostat[i].nreq, iostat[i].maxwait,
+            iostat[i].depth / iostat[i].nreq, iostat[i].maxdepth);
+  }
+}
@@ -0,0 +1,1252 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 00 10 00 00       	push   $0x1000
+  19:	e8 55 03 00 00       	call   373 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 78 03 00 00       	call   3ab <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 6c 03 00 00       	call   3ab <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 08 10 00 00       	push   $0x1008
+  50:	6a 01                	push   $0x1
+  52:	e8 79 04 00 00       	call   4d0 <printf>
+    pid = fork();
+  57:	e8 cf 02 00 00       	call   32b <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 c6 02 00 00       	call   33b <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 47 10 00 00       	push   $0x1047
+  85:	6a 01                	push   $0x1
+  87:	e8 44 04 00 00       	call   4d0 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 1b 10 00 00       	push   $0x101b
+  98:	6a 01                	push   $0x1
+  9a:	e8 31 04 00 00       	call   4d0 <printf>
+      exit();
+  9f:	e8 8f 02 00 00       	call   333 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 00 20 00 00       	push   $0x2000
+  ab:	68 2e 10 00 00       	push   $0x102e
+  b0:	e8 b6 02 00 00       	call   36b <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 31 10 00 00       	push   $0x1031
+  bc:	6a 01                	push   $0x1
+  be:	e8 0d 04 00 00       	call   4d0 <printf>
+      exit();
+  c3:	e8 6b 02 00 00       	call   333 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 00 10 00 00       	push   $0x1000
+  d2:	e8 a4 02 00 00       	call   37b <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 00 10 00 00       	push   $0x1000
+  e0:	e8 8e 02 00 00       	call   373 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 219:	31 db                	xor    %ebx,%ebx
+{
+ 21b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	eb 27                	jmp    247 <gets+0x37>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	56                   	push   %esi
+ 226:	6a 00                	push   $0x0
+ 228:	e8 1e 01 00 00       	call   34b <read>
+    if(cc < 1)
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	7e 1d                	jle    251 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 10                	je     253 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	74 0c                	je     253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 247:	89 df                	mov    %ebx,%edi
+ 249:	83 c3 01             	add    $0x1,%ebx
+ 24c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 24f:	7c cf                	jl     220 <gets+0x10>
+ 251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 275:	83 ec 08             	sub    $0x8,%esp
+ 278:	6a 00                	push   $0x0
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 f1 00 00 00       	call   373 <open>
+  if(fd < 0)
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	85 c0                	test   %eax,%eax
+ 287:	78 27                	js     2b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	ff 75 0c             	push   0xc(%ebp)
+ 28f:	89 c3                	mov    %eax,%ebx
+ 291:	50                   	push   %eax
+ 292:	e8 f4 00 00 00       	call   38b <fstat>
+  close(fd);
+ 297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 29a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29c:	e8 ba 00 00 00       	call   35b <close>
+  return r;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+}
+ 2a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b5:	eb ed                	jmp    2a4 <stat+0x34>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2c7:	0f be 02             	movsbl (%edx),%eax
+ 2ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2d5:	77 1e                	ja     2f5 <atoi+0x35>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ea:	0f be 02             	movsbl (%edx),%eax
+ 2ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2f0:	80 fb 09             	cmp    $0x9,%bl
+ 2f3:	76 eb                	jbe    2e0 <atoi+0x20>
+  return n;
+}
+ 2f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f8:	89 c8                	mov    %ecx,%eax
+ 2fa:	c9                   	leave
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	8b 45 10             	mov    0x10(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 30e:	85 c0                	test   %eax,%eax
+ 310:	7e 13                	jle    325 <memmove+0x25>
+ 312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 314:	89 d7                	mov    %edx,%edi
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 321:	39 f8                	cmp    %edi,%eax
+ 323:	75 fb                	jne    320 <memmove+0x20>
+  return vdst;
+}
+ 325:	5e                   	pop    %esi
+ 326:	89 d0                	mov    %edx,%eax
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+ 32a:	c3                   	ret
+
+0000032b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 32b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <exit>:
+SYSCALL(exit)
+ 333:	b8 02 00 00 00       	mov    $0x2,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <wait>:
+SYSCALL(wait)
+ 33b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <pipe>:
+SYSCALL(pipe)
+ 343:	b8 04 00 00 00       	mov    $0x4,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <read>:
+SYSCALL(read)
+ 34b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <write>:
+SYSCALL(write)
+ 353:	b8 10 00 00 00       	mov    $0x10,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <close>:
+SYSCALL(close)
+ 35b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <kill>:
+SYSCALL(kill)
+ 363:	b8 06 00 00 00       	mov    $0x6,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <exec>:
+SYSCALL(exec)
+ 36b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <open>:
+SYSCALL(open)
+ 373:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <mknod>:
+SYSCALL(mknod)
+ 37b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <unlink>:
+SYSCALL(unlink)
+ 383:	b8 12 00 00 00       	mov    $0x12,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <fstat>:
+SYSCALL(fstat)
+ 38b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <link>:
+SYSCALL(link)
+ 393:	b8 13 00 00 00       	mov    $0x13,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mkdir>:
+SYSCALL(mkdir)
+ 39b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <chdir>:
+SYSCALL(chdir)
+ 3a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <dup>:
+SYSCALL(dup)
+ 3ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <getpid>:
+SYSCALL(getpid)
+ 3b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <sbrk>:
+SYSCALL(sbrk)
+ 3bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <sleep>:
+SYSCALL(sleep)
+ 3c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <uptime>:
+SYSCALL(uptime)
+ 3cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <wmap>:
+SYSCALL(wmap)
+ 3d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <wunmap>:
+SYSCALL(wunmap)
+ 3db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <va2pa>:
+SYSCALL(va2pa)
+ 3e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 3eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <getwssinfo>:
+SYSCALL(getwssinfo)
+ 3f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <setmergeable>:
+SYSCALL(setmergeable)
+ 3fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getvmstat>:
+SYSCALL(getvmstat)
+ 403:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getfaulthist>:
+SYSCALL(getfaulthist)
+ 40b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getprocinfo>:
+SYSCALL(getprocinfo)
+ 413:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <spawn>:
+SYSCALL(spawn)
+ 41b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <fsync>:
+SYSCALL(fsync)
+ 423:	b8 20 00 00 00       	mov    $0x20,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+ 42b:	66 90                	xchg   %ax,%ax
+ 42d:	66 90                	xchg   %ax,%ax
+ 42f:	90                   	nop
+
+00000430 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 438:	89 d1                	mov    %edx,%ecx
+{
+ 43a:	83 ec 3c             	sub    $0x3c,%esp
+ 43d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 440:	85 d2                	test   %edx,%edx
+ 442:	0f 89 80 00 00 00    	jns    4c8 <printint+0x98>
+ 448:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 44c:	74 7a                	je     4c8 <printint+0x98>
+    x = -xx;
+ 44e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 450:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 455:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 458:	31 f6                	xor    %esi,%esi
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 460:	89 c8                	mov    %ecx,%eax
+ 462:	31 d2                	xor    %edx,%edx
+ 464:	89 f7                	mov    %esi,%edi
+ 466:	f7 f3                	div    %ebx
+ 468:	8d 76 01             	lea    0x1(%esi),%esi
+ 46b:	0f b6 92 b0 10 00 00 	movzbl 0x10b0(%edx),%edx
+ 472:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 476:	89 ca                	mov    %ecx,%edx
+ 478:	89 c1                	mov    %eax,%ecx
+ 47a:	39 da                	cmp    %ebx,%edx
+ 47c:	73 e2                	jae    460 <printint+0x30>
+  if(neg)
+ 47e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 481:	85 c0                	test   %eax,%eax
+ 483:	74 07                	je     48c <printint+0x5c>
+    buf[i++] = '-';
+ 485:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 48a:	89 f7                	mov    %esi,%edi
+ 48c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 48f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 492:	01 df                	add    %ebx,%edi
+ 494:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 498:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 49b:	83 ec 04             	sub    $0x4,%esp
+ 49e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4a4:	6a 01                	push   $0x1
+ 4a6:	50                   	push   %eax
+ 4a7:	56                   	push   %esi
+ 4a8:	e8 a6 fe ff ff       	call   353 <write>
+  while(--i >= 0)
+ 4ad:	89 f8                	mov    %edi,%eax
+ 4af:	83 c4 10             	add    $0x10,%esp
+ 4b2:	83 ef 01             	sub    $0x1,%edi
+ 4b5:	39 d8                	cmp    %ebx,%eax
+ 4b7:	75 df                	jne    498 <printint+0x68>
+}
+ 4b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bc:	5b                   	pop    %ebx
+ 4bd:	5e                   	pop    %esi
+ 4be:	5f                   	pop    %edi
+ 4bf:	5d                   	pop    %ebp
+ 4c0:	c3                   	ret
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4c8:	31 c0                	xor    %eax,%eax
+ 4ca:	eb 89                	jmp    455 <printint+0x25>
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4df:	0f b6 1e             	movzbl (%esi),%ebx
+ 4e2:	83 c6 01             	add    $0x1,%esi
+ 4e5:	84 db                	test   %bl,%bl
+ 4e7:	74 67                	je     550 <printf+0x80>
+ 4e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4ec:	31 d2                	xor    %edx,%edx
+ 4ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4f1:	eb 34                	jmp    527 <printf+0x57>
+ 4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4f7:	90                   	nop
+ 4f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 500:	83 f8 25             	cmp    $0x25,%eax
+ 503:	74 18                	je     51d <printf+0x4d>
+  write(fd, &c, 1);
+ 505:	83 ec 04             	sub    $0x4,%esp
+ 508:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 50b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 50e:	6a 01                	push   $0x1
+ 510:	50                   	push   %eax
+ 511:	57                   	push   %edi
+ 512:	e8 3c fe ff ff       	call   353 <write>
+ 517:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 51a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 51d:	0f b6 1e             	movzbl (%esi),%ebx
+ 520:	83 c6 01             	add    $0x1,%esi
+ 523:	84 db                	test   %bl,%bl
+ 525:	74 29                	je     550 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 527:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 52a:	85 d2                	test   %edx,%edx
+ 52c:	74 ca                	je     4f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 52e:	83 fa 25             	cmp    $0x25,%edx
+ 531:	75 ea                	jne    51d <printf+0x4d>
+      if(c == 'd'){
+ 533:	83 f8 25             	cmp    $0x25,%eax
+ 536:	0f 84 24 01 00 00    	je     660 <printf+0x190>
+ 53c:	83 e8 63             	sub    $0x63,%eax
+ 53f:	83 f8 15             	cmp    $0x15,%eax
+ 542:	77 1c                	ja     560 <printf+0x90>
+ 544:	ff 24 85 58 10 00 00 	jmp    *0x1058(,%eax,4)
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 550:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 553:	5b                   	pop    %ebx
+ 554:	5e                   	pop    %esi
+ 555:	5f                   	pop    %edi
+ 556:	5d                   	pop    %ebp
+ 557:	c3                   	ret
+ 558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+  write(fd, &c, 1);
+ 560:	83 ec 04             	sub    $0x4,%esp
+ 563:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 566:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 56a:	6a 01                	push   $0x1
+ 56c:	52                   	push   %edx
+ 56d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 570:	57                   	push   %edi
+ 571:	e8 dd fd ff ff       	call   353 <write>
+ 576:	83 c4 0c             	add    $0xc,%esp
+ 579:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 57c:	6a 01                	push   $0x1
+ 57e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 581:	52                   	push   %edx
+ 582:	57                   	push   %edi
+ 583:	e8 cb fd ff ff       	call   353 <write>
+        putc(fd, c);
+ 588:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58b:	31 d2                	xor    %edx,%edx
+ 58d:	eb 8e                	jmp    51d <printf+0x4d>
+ 58f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 590:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 593:	83 ec 0c             	sub    $0xc,%esp
+ 596:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 59b:	8b 13                	mov    (%ebx),%edx
+ 59d:	6a 00                	push   $0x0
+ 59f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5a4:	e8 87 fe ff ff       	call   430 <printint>
+        ap++;
+ 5a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5af:	31 d2                	xor    %edx,%edx
+ 5b1:	e9 67 ff ff ff       	jmp    51d <printf+0x4d>
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5c5:	83 c0 04             	add    $0x4,%eax
+ 5c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5cb:	85 db                	test   %ebx,%ebx
+ 5cd:	0f 84 9d 00 00 00    	je     670 <printf+0x1a0>
+        while(*s != 0){
+ 5d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	0f 84 3d ff ff ff    	je     51d <printf+0x4d>
+ 5e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5e6:	89 de                	mov    %ebx,%esi
+ 5e8:	89 d3                	mov    %edx,%ebx
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	53                   	push   %ebx
+ 5fc:	57                   	push   %edi
+ 5fd:	e8 51 fd ff ff       	call   353 <write>
+        while(*s != 0){
+ 602:	0f b6 06             	movzbl (%esi),%eax
+ 605:	83 c4 10             	add    $0x10,%esp
+ 608:	84 c0                	test   %al,%al
+ 60a:	75 e4                	jne    5f0 <printf+0x120>
+      state = 0;
+ 60c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 60f:	31 d2                	xor    %edx,%edx
+ 611:	e9 07 ff ff ff       	jmp    51d <printf+0x4d>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 620:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 62b:	8b 13                	mov    (%ebx),%edx
+ 62d:	6a 01                	push   $0x1
+ 62f:	e9 6b ff ff ff       	jmp    59f <printf+0xcf>
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 638:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 641:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 643:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 646:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 649:	6a 01                	push   $0x1
+ 64b:	52                   	push   %edx
+ 64c:	57                   	push   %edi
+ 64d:	e8 01 fd ff ff       	call   353 <write>
+        ap++;
+ 652:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 655:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 658:	31 d2                	xor    %edx,%edx
+ 65a:	e9 be fe ff ff       	jmp    51d <printf+0x4d>
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 666:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 669:	6a 01                	push   $0x1
+ 66b:	e9 11 ff ff ff       	jmp    581 <printf+0xb1>
+ 670:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 675:	bb 50 10 00 00       	mov    $0x1050,%ebx
+ 67a:	e9 61 ff ff ff       	jmp    5e0 <printf+0x110>
+ 67f:	90                   	nop
+
+00000680 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 680:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 681:	a1 08 20 00 00       	mov    0x2008,%eax
+{
+ 686:	89 e5                	mov    %esp,%ebp
+ 688:	57                   	push   %edi
+ 689:	56                   	push   %esi
+ 68a:	53                   	push   %ebx
+ 68b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 68e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 698:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 69a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 69c:	39 ca                	cmp    %ecx,%edx
+ 69e:	73 30                	jae    6d0 <free+0x50>
+ 6a0:	39 c1                	cmp    %eax,%ecx
+ 6a2:	72 04                	jb     6a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a4:	39 c2                	cmp    %eax,%edx
+ 6a6:	72 f0                	jb     698 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6ae:	39 f8                	cmp    %edi,%eax
+ 6b0:	74 2e                	je     6e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6bb:	39 f1                	cmp    %esi,%ecx
+ 6bd:	74 38                	je     6f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6c1:	5b                   	pop    %ebx
+  freep = p;
+ 6c2:	89 15 08 20 00 00    	mov    %edx,0x2008
+}
+ 6c8:	5e                   	pop    %esi
+ 6c9:	5f                   	pop    %edi
+ 6ca:	5d                   	pop    %ebp
+ 6cb:	c3                   	ret
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d0:	39 c1                	cmp    %eax,%ecx
+ 6d2:	72 d0                	jb     6a4 <free+0x24>
+ 6d4:	eb c2                	jmp    698 <free+0x18>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6e0:	03 70 04             	add    0x4(%eax),%esi
+ 6e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6e6:	8b 02                	mov    (%edx),%eax
+ 6e8:	8b 00                	mov    (%eax),%eax
+ 6ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 6f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6f3:	39 f1                	cmp    %esi,%ecx
+ 6f5:	75 c8                	jne    6bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 6f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6fa:	89 15 08 20 00 00    	mov    %edx,0x2008
+    p->s.size += bp->s.size;
+ 700:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 703:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 706:	89 0a                	mov    %ecx,(%edx)
+}
+ 708:	5b                   	pop    %ebx
+ 709:	5e                   	pop    %esi
+ 70a:	5f                   	pop    %edi
+ 70b:	5d                   	pop    %ebp
+ 70c:	c3                   	ret
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000710 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 719:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 71c:	8b 15 08 20 00 00    	mov    0x2008,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 722:	8d 78 07             	lea    0x7(%eax),%edi
+ 725:	c1 ef 03             	shr    $0x3,%edi
+ 728:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 72b:	85 d2                	test   %edx,%edx
+ 72d:	0f 84 8d 00 00 00    	je     7c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 733:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 735:	8b 48 04             	mov    0x4(%eax),%ecx
+ 738:	39 f9                	cmp    %edi,%ecx
+ 73a:	73 64                	jae    7a0 <malloc+0x90>
+  if(nu < 4096)
+ 73c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 741:	39 df                	cmp    %ebx,%edi
+ 743:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 746:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 74d:	eb 0a                	jmp    759 <malloc+0x49>
+ 74f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 750:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 752:	8b 48 04             	mov    0x4(%eax),%ecx
+ 755:	39 f9                	cmp    %edi,%ecx
+ 757:	73 47                	jae    7a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 759:	89 c2                	mov    %eax,%edx
+ 75b:	39 05 08 20 00 00    	cmp    %eax,0x2008
+ 761:	75 ed                	jne    750 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 763:	83 ec 0c             	sub    $0xc,%esp
+ 766:	56                   	push   %esi
+ 767:	e8 4f fc ff ff       	call   3bb <sbrk>
+  if(p == (char*)-1)
+ 76c:	83 c4 10             	add    $0x10,%esp
+ 76f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 772:	74 1c                	je     790 <malloc+0x80>
+  hp->s.size = nu;
+ 774:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 777:	83 ec 0c             	sub    $0xc,%esp
+ 77a:	83 c0 08             	add    $0x8,%eax
+ 77d:	50                   	push   %eax
+ 77e:	e8 fd fe ff ff       	call   680 <free>
+  return freep;
+ 783:	8b 15 08 20 00 00    	mov    0x2008,%edx
+      if((p = morecore(nunits)) == 0)
+ 789:	83 c4 10             	add    $0x10,%esp
+ 78c:	85 d2                	test   %edx,%edx
+ 78e:	75 c0                	jne    750 <malloc+0x40>
+        return 0;
+  }
+}
+ 790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 793:	31 c0                	xor    %eax,%eax
+}
+ 795:	5b                   	pop    %ebx
+ 796:	5e                   	pop    %esi
+ 797:	5f                   	pop    %edi
+ 798:	5d                   	pop    %ebp
+ 799:	c3                   	ret
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7a0:	39 cf                	cmp    %ecx,%edi
+ 7a2:	74 4c                	je     7f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7a4:	29 f9                	sub    %edi,%ecx
+ 7a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7af:	89 15 08 20 00 00    	mov    %edx,0x2008
+}
+ 7b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7b8:	83 c0 08             	add    $0x8,%eax
+}
+ 7bb:	5b                   	pop    %ebx
+ 7bc:	5e                   	pop    %esi
+ 7bd:	5f                   	pop    %edi
+ 7be:	5d                   	pop    %ebp
+ 7bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7c0:	c7 05 08 20 00 00 0c 	movl   $0x200c,0x2008
+ 7c7:	20 00 00 
+    base.s.size = 0;
+ 7ca:	b8 0c 20 00 00       	mov    $0x200c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7cf:	c7 05 0c 20 00 00 0c 	movl   $0x200c,0x200c
+ 7d6:	20 00 00 
+    base.s.size = 0;
+ 7d9:	c7 05 10 20 00 00 00 	movl   $0x0,0x2010
+ 7e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7e3:	e9 54 ff ff ff       	jmp    73c <malloc+0x2c>
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7f0:	8b 08                	mov    (%eax),%ecx
+ 7f2:	89 0a                	mov    %ecx,(%edx)
+ 7f4:	eb b9                	jmp    7af <malloc+0x9f>
@@ -1,30 +1,80 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Underneath is a binary buddy allocator: free memory is kept
+// as naturally aligned blocks of 2^order pages, order 0 to
+// MAXORDER, and a freed block is merged with its buddy whenever
+// the buddy is free too. kalloc_pages()/kfree_pages() hand out
+// physically contiguous blocks; kalloc()/kfree() are the order-0
+// case.
+//
+// Order-0 pages also go through small per-CPU lists in front of
+// the buddy allocator. kalloc() and kfree() only touch the
+// current CPU's list; pages move between it and the buddy
+// allocator PCPBATCH at a time under kmem.lock.
+//
+// Idle CPUs keep a pool of pre-zeroed pages topped up (see
+// kzeroidle), which kalloc_zeroed() hands out so that fault and
+// allocuvm paths need not clear pages themselves.
+//
+// Build with -DKALLOC_JUNK to fill freed pages with junk, which
+// helps catch dangling references.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "stdint.h"
 
+#define PCPBATCH 16  // pages moved to/from the buddy allocator at once
+#define PCPHIGH  64  // spill to the buddy allocator above this many pages
+#define ZPOOLMAX 64  // pre-zeroed pages kept ready
+#define ZFILLBATCH 4 // pages zeroed per idle scheduler pass
+
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
 unsigned char pagerefs[NPAGES] = {0};
 
+// Free blocks are linked through their first page.
 struct run {
   struct run *next;
+  struct run *prev;
+};
+
+// Per-CPU cache of free pages. The lock is only ever contended
+// when another CPU drains this cache because memory is short.
+struct pcp {
+  struct spinlock lock;
+  struct run *freelist;
+  int count;
 };
 
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *freelist[MAXORDER+1];  // free blocks of each order
+  uint nfree[MAXORDER+1];            // length of each freelist
+  uint nsplit;                       // blocks split to satisfy a smaller order
+  uint nmerge;                       // blocks merged with their buddy
+  // freeorder[pfn] is order+1 if pfn heads a free block of that
+  // order, 0 otherwise. Only consulted under kmem.lock.
+  uchar freeorder[PHYSTOP/PGSIZE];
+  struct pcp pcp[NCPU];
 } kmem;
 
+// Pool of zero-filled pages. Pages are linked through their first
+// word, which is cleared again when a page leaves the pool.
+struct {
+  struct spinlock lock;
+  struct run *list;
+  int n;
+} zpool;
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -33,7 +83,12 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  initlock(&zpool.lock, "zpool");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.pcp[i].lock, "kmem pcp");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -45,15 +100,207 @@ kinit2(void *vstart, void *vend)
   kmem.use_lock = 1;
 }
 
+// Free [vstart, vend) as the largest aligned blocks that fit.
 void
 freerange(void *vstart, void *vend)
 {
   char *p;
+  int order;
+
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
-    kfree(p);
+  while(p + PGSIZE <= (char*)vend){
+    order = 0;
+    while(order < MAXORDER &&
+          (PFN(V2P(p)) & ((2 << order) - 1)) == 0 &&
+          p + (2 << order)*PGSIZE <= (char*)vend)
+      order++;
+    kfree_pages(p, order);
+    p += (1 << order)*PGSIZE;
+  }
+}
+
+static void
+listpush(struct run *r, int order)
+{
+  r->prev = 0;
+  r->next = kmem.freelist[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.freelist[order] = r;
+  kmem.nfree[order]++;
+  kmem.freeorder[PFN(V2P(r))] = order + 1;
+}
+
+static void
+listremove(struct run *r, int order)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.freelist[order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.nfree[order]--;
+  kmem.freeorder[PFN(V2P(r))] = 0;
 }
+
+// Take a block of 2^order pages, splitting a larger block
+// if necessary. Caller holds kmem.lock.
+static char*
+buddyalloc(int order)
+{
+  struct run *r;
+  int k;
+
+  for(k = order; k <= MAXORDER; k++)
+    if(kmem.freelist[k])
+      break;
+  if(k > MAXORDER)
+    return 0;
+  r = kmem.freelist[k];
+  listremove(r, k);
+  // Give back the upper half at each level.
+  while(k > order){
+    k--;
+    listpush((struct run*)((char*)r + (1 << k)*PGSIZE), k);
+    kmem.nsplit++;
+  }
+  return (char*)r;
+}
+
+// Return a block of 2^order pages, merging it with its
+// buddy as long as the buddy is free. Caller holds kmem.lock.
+static void
+buddyfree(char *v, int order)
+{
+  uint pfn, bpfn;
+
+  pfn = PFN(V2P(v));
+  while(order < MAXORDER){
+    bpfn = pfn ^ (1 << order);
+    if(bpfn >= PHYSTOP/PGSIZE || kmem.freeorder[bpfn] != order + 1)
+      break;
+    listremove((struct run*)P2V(bpfn * PGSIZE), order);
+    pfn &= ~(1 << order);
+    order++;
+    kmem.nmerge++;
+  }
+  listpush((struct run*)P2V(pfn * PGSIZE), order);
+}
+
+// Move up to n pages from the buddy allocator to pcp.
+// Caller holds pcp->lock.
+static void
+pcprefill(struct pcp *pcp, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (r = (struct run*)buddyalloc(0)) != 0){
+    r->next = pcp->freelist;
+    pcp->freelist = r;
+    pcp->count++;
+  }
+  release(&kmem.lock);
+}
+
+// Move up to n pages from pcp back to the buddy allocator.
+// Caller holds pcp->lock.
+static void
+pcpspill(struct pcp *pcp, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (r = pcp->freelist) != 0){
+    pcp->freelist = r->next;
+    pcp->count--;
+    buddyfree((char*)r, 0);
+  }
+  release(&kmem.lock);
+}
+
+// Return every CPU's cached pages to the buddy allocator, so
+// that an allocation that could not be satisfied can still use
+// pages parked on other CPUs (and larger blocks can re-form).
+static void
+pcpdrainall(void)
+{
+  struct pcp *pcp;
+
+  for(pcp = kmem.pcp; pcp < &kmem.pcp[NCPU]; pcp++){
+    acquire(&pcp->lock);
+    pcpspill(pcp, pcp->count);
+    release(&pcp->lock);
+  }
+}
+
+// Check v and drop one reference to it. Returns the page as a
+// free list entry if that was the last reference, else 0.
+static struct run*
+putpage(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kfree");
+
+  if (pagerefs[PFN(V2P(v))] > 1) {
+    pagerefs[PFN(V2P(v))]--;
+    return 0;
+  }
+#ifdef KALLOC_JUNK
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE);
+#endif
+  return (struct run*)v;
+}
+
 //PAGEBREAK: 21
+// Free n pages of physical memory. Pages that are still
+// shared (see pagerefs) only lose a reference. All pages
+// really freed go onto this CPU's list under a single lock
+// acquisition.
+void
+kfree_bulk(char **v, int n)
+{
+  struct run *r, *head, *tail;
+  struct pcp *pcp;
+  int i, cnt;
+
+  head = tail = 0;
+  cnt = 0;
+  for(i = 0; i < n; i++){
+    if((r = putpage(v[i])) == 0)
+      continue;
+    r->next = head;
+    head = r;
+    if(tail == 0)
+      tail = r;
+    cnt++;
+  }
+  if(cnt == 0)
+    return;
+
+  if(!kmem.use_lock){
+    for(r = head; r; r = head){
+      head = r->next;
+      buddyfree((char*)r, 0);
+    }
+    return;
+  }
+
+  pushcli();
+  mycpu()->vmevent[VM_KFREE] += cnt;
+  pcp = &kmem.pcp[cpuid()];
+  acquire(&pcp->lock);
+  tail->next = pcp->freelist;
+  pcp->freelist = head;
+  pcp->count += cnt;
+  if(pcp->count > PCPHIGH)
+    pcpspill(pcp, pcp->count - PCPHIGH + PCPBATCH);
+  release(&pcp->lock);
+  popcli();
+}
+
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
@@ -61,26 +308,137 @@ freerange(void *vstart, void *vend)
 void
 kfree(char *v)
 {
-  struct run *r;
+  kfree_bulk(&v, 1);
+}
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
-    panic("kfree");
+// Free a block of 2^order contiguous pages returned
+// by kalloc_pages(order).
+void
+kfree_pages(char *v, int order)
+{
+  int i;
 
-  if (pagerefs[PFN(V2P(v))] > 1) {
-    pagerefs[PFN(V2P(v))]--;
+  if(order < 0 || order > MAXORDER ||
+     (uint)v % ((1 << order)*PGSIZE) || v < end ||
+     V2P(v) + (1 << order)*PGSIZE > PHYSTOP)
+    panic("kfree_pages");
+
+#ifdef KALLOC_JUNK
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, (1 << order)*PGSIZE);
+#endif
+  for(i = 0; i < (1 << order); i++)
+    pagerefs[PFN(V2P(v)) + i] = 0;
+
+  if(kmem.use_lock){
+    vmcount(VM_KFREE, 1 << order);
+    acquire(&kmem.lock);
   }
-  else {
-    // Fill with junk to catch dangling refs.
-    memset(v, 1, PGSIZE);
+  buddyfree(v, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
 
+// Allocate 2^order physically contiguous pages, aligned
+// to their size. Returns 0 if no such block is free.
+char*
+kalloc_pages(int order)
+{
+  char *v;
+  int i;
+
+  if(order < 0 || order > MAXORDER)
+    return 0;
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  v = buddyalloc(order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if(v == 0 && kmem.use_lock){
+    pcpdrainall();
+    acquire(&kmem.lock);
+    v = buddyalloc(order);
+    release(&kmem.lock);
+  }
+  if(v){
+    for(i = 0; i < (1 << order); i++)
+      pagerefs[PFN(V2P(v)) + i] = 1;
     if(kmem.use_lock)
-      acquire(&kmem.lock);
-    r = (struct run*)v;
-    r->next = kmem.freelist;
-    kmem.freelist = r;
-    if(kmem.use_lock)
-      release(&kmem.lock);
+      vmcount(VM_KALLOC, 1 << order);
   }
+  return v;
+}
+
+// Take up to n pages from the zeroed pool into v.
+// Returns how many were taken.
+static int
+zpoolget(char **v, int n)
+{
+  struct run *r;
+  int i;
+
+  if(zpool.n == 0)
+    return 0;
+  acquire(&zpool.lock);
+  for(i = 0; i < n && (r = zpool.list) != 0; i++){
+    zpool.list = r->next;
+    zpool.n--;
+    r->next = 0;
+    v[i] = (char*)r;
+  }
+  release(&zpool.lock);
+  return i;
+}
+
+// Allocate n 4096-byte pages into v[0..n-1].
+// Returns the number of pages allocated, which is
+// less than n only if memory is exhausted.
+int
+kalloc_bulk(char **v, int n)
+{
+  struct run *r;
+  struct pcp *pcp;
+  int i, nz, drained;
+
+  if(!kmem.use_lock){
+    for(i = 0; i < n && (v[i] = buddyalloc(0)) != 0; i++)
+      pagerefs[PFN(V2P(v[i]))] = 1;
+    return i;
+  }
+
+  drained = nz = 0;
+  pushcli();
+  pcp = &kmem.pcp[cpuid()];
+  acquire(&pcp->lock);
+  for(i = 0; i < n; i++){
+    if(pcp->freelist == 0){
+      pcprefill(pcp, n - i > PCPBATCH ? n - i : PCPBATCH);
+      if(pcp->freelist == 0 && !drained){
+        release(&pcp->lock);
+        pcpdrainall();
+        drained = 1;
+        acquire(&pcp->lock);
+        pcprefill(pcp, n - i > PCPBATCH ? n - i : PCPBATCH);
+      }
+      if(pcp->freelist == 0){
+        // Last resort: pages set aside for kalloc_zeroed().
+        if(zpoolget(&v[i], 1) == 0)
+          break;
+        nz++;
+        continue;
+      }
+    }
+    r = pcp->freelist;
+    pcp->freelist = r->next;
+    pcp->count--;
+    pagerefs[PFN(V2P(r))] = 1;
+    v[i] = (char*)r;
+  }
+  release(&pcp->lock);
+  // Pool pages were counted when kzeroidle() allocated them.
+  mycpu()->vmevent[VM_KALLOC] += i - nz;
+  popcli();
+  return i;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -88,17 +446,105 @@ kfree(char *v)
 // Returns 0 if the memory cannot be allocated.
 char*
 kalloc(void)
+{
+  char *v;
+
+  if(kalloc_bulk(&v, 1) == 0)
+    return 0;
+  return v;
+}
+
+// Allocate n zero-filled pages into v[0..n-1], preferring
+// the pre-zeroed pool. Returns the number allocated.
+int
+kalloc_zeroed_bulk(char **v, int n)
+{
+  int i, got;
+
+  i = zpoolget(v, n);
+  got = i + kalloc_bulk(v + i, n - i);
+  for(; i < got; i++)
+    memset(v[i], 0, PGSIZE);
+  return got;
+}
+
+// Allocate one zero-filled page. Returns 0 if out of memory.
+char*
+kalloc_zeroed(void)
+{
+  char *v;
+
+  if(kalloc_zeroed_bulk(&v, 1) == 0)
+    return 0;
+  return v;
+}
+
+// Called from an idle CPU's scheduler loop with no locks held:
+// zero a few free pages and add them to the pool. The other CPUs
+// idle before kinit2(), while the allocator still runs without
+// locks for the boot CPU alone, so do nothing until then.
+void
+kzeroidle(void)
 {
   struct run *r;
+  int i;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(!kmem.use_lock)
+    return;
+  for(i = 0; i < ZFILLBATCH && zpool.n < ZPOOLMAX; i++){
+    if((r = (struct run*)kalloc()) == 0)
+      return;
+    memset(r, 0, PGSIZE);
+    acquire(&zpool.lock);
+    r->next = zpool.list;
+    zpool.list = r;
+    zpool.n++;
+    release(&zpool.lock);
+  }
+}
 
-  pagerefs[PFN(V2P(r))] = 1;
-  return (char*)r;
+// Number of free pages, including per-CPU caches and the
+// pre-zeroed pool. Read without locks, so only approximate;
+// good enough for reclaim watermarks.
+int
+kfreecount(void)
+{
+  struct pcp *pcp;
+  int k, n;
+
+  n = zpool.n;
+  for(k = 0; k <= MAXORDER; k++)
+    n += kmem.nfree[k] << k;
+  for(pcp = kmem.pcp; pcp < &kmem.pcp[NCPU]; pcp++)
+    n += pcp->count;
+  return n;
+}
+
+// Print the buddy allocator's free block counts, and for each
+// order the share of free memory sitting in blocks too small
+// to satisfy it (the fragmentation index). Runs on ^P; no lock
+// to avoid wedging a stuck machine further.
+void
+kallocdump(void)
+{
+  struct pcp *pcp;
+  uint total, small;
+  int k;
+
+  total = 0;
+  for(k = 0; k <= MAXORDER; k++)
+    total += kmem.nfree[k] << k;
+  cprintf("buddy: %d free pages, %d splits, %d merges\n",
+          total, kmem.nsplit, kmem.nmerge);
+  small = 0;
+  for(k = 0; k <= MAXORDER; k++){
+    cprintf(" order %d: %d free, %d%% unusable\n", k, kmem.nfree[k],
+            total ? small*100/total : 0);
+    small += kmem.nfree[k] << k;
+  }
+  total = 0;
+  for(pcp = kmem.pcp; pcp < &kmem.pcp[NCPU]; pcp++)
+    total += pcp->count;
+  cprintf(" per-cpu cached: %d pages, pre-zeroed: %d pages\n",
+          total, zpool.n);
 }
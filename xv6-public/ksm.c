@@ -0,0 +1,272 @@
+// Same-page merging.
+//
+// Processes that opt in with setmergeable(1) (and their children)
+// have the private pages of their image scanned from an idle CPU,
+// KSMBATCH pages every KSMPERIOD ticks. Each page that has sat
+// unused for a working-set period (PTEAGE > 0, see wss.c) is
+// hashed and looked up in a small table:
+//
+//  - a stable entry is a frame already shared read-only by merged
+//    pages; if the contents match, the page is remapped to it;
+//  - a candidate entry is an unmerged page seen earlier with the
+//    same hash; if the contents still match, the candidate is made
+//    read-only, the page is remapped to it, and it becomes stable;
+//  - otherwise the page becomes a candidate.
+//
+// A stable frame takes no more merges once KSMMAXREF mappings
+// share it; a matching candidate then becomes a second one.
+//
+// Merged mappings are COW mappings like fork's (PTE_OW and a
+// pagerefs count), so a write splits the page again through the
+// ordinary fault path. An entry remembers one mapping of its frame
+// and is dropped as soon as that mapping no longer maps the frame
+// read-only; until then no other mapping can be writable, since
+// the fault path only makes a page writable in place when it has
+// a single reference.
+//
+// Only pages of processes that cannot be using their page tables
+// (swappable() in swap.c) are touched, and everything runs under
+// the process table lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+
+#define KSMPERIOD 10    // ticks between scans
+#define KSMBATCH  64    // pages looked at per scan
+#define NKPAGE    256   // stable and candidate entries
+#define NKBUCKET  64
+#define KSMMAXREF (255 - NPROC)  // pagerefs is a byte; leave room for fork
+
+extern unsigned char pagerefs[NPAGES];
+extern pte_t* walkpgdir(pde_t *pgdir, const void *va, int alloc);
+
+struct kpage {
+  uint hash;
+  uint pa;
+  struct proc *p;       // a process mapping pa
+  int pid;
+  uint va;              // ... and where
+  int stable;
+  struct kpage *next;   // hash chain, or free list
+};
+
+struct {
+  struct kpage page[NKPAGE];
+  struct kpage *bucket[NKBUCKET];
+  struct kpage *free;
+  uint last;            // ticks at the last scan
+  int handproc;         // scan position
+  uint handva;
+  int nvictim;          // next candidate to recycle when full
+  uint nmerge;          // merges done
+  uint nscan;           // pages hashed
+} ksm;
+
+void
+ksminit(void)
+{
+  struct kpage *k;
+
+  for(k = ksm.page; k < &ksm.page[NKPAGE]; k++){
+    k->next = ksm.free;
+    ksm.free = k;
+  }
+}
+
+static uint
+pagehash(uint *w)
+{
+  uint h, i;
+
+  h = 2166136261U;
+  for(i = 0; i < PGSIZE/sizeof(uint); i++)
+    h = (h ^ w[i]) * 16777619U;
+  return h;
+}
+
+static void
+kpageremove(struct kpage *k)
+{
+  struct kpage **pp;
+
+  for(pp = &ksm.bucket[k->hash % NKBUCKET]; *pp; pp = &(*pp)->next){
+    if(*pp == k){
+      *pp = k->next;
+      k->stable = 0;
+      k->pa = 0;
+      k->next = ksm.free;
+      ksm.free = k;
+      return;
+    }
+  }
+  panic("kpageremove");
+}
+
+static struct kpage*
+kpageinsert(uint hash)
+{
+  struct kpage *k;
+  int i;
+
+  if(ksm.free == 0){
+    // Full: recycle a candidate.
+    for(i = 0; i < NKPAGE; i++){
+      k = &ksm.page[ksm.nvictim];
+      ksm.nvictim = (ksm.nvictim + 1) % NKPAGE;
+      if(!k->stable){
+        kpageremove(k);
+        break;
+      }
+    }
+    if(ksm.free == 0)
+      return 0;
+  }
+  k = ksm.free;
+  ksm.free = k->next;
+  k->hash = hash;
+  k->next = ksm.bucket[hash % NKBUCKET];
+  ksm.bucket[hash % NKBUCKET] = k;
+  return k;
+}
+
+// The PTE through which k's recorded mapping still maps k->pa,
+// or 0 if it no longer does. A stable entry's mapping must also
+// still be read-only; a candidate must still be private.
+// The caller has checked that k->p is swappable.
+static pte_t*
+kpagepte(struct kpage *k)
+{
+  pte_t *pte;
+
+  if((pte = walkpgdir(k->p->pgdir, (void*)k->va, 0)) == 0 ||
+     (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) || PTE_ADDR(*pte) != k->pa)
+    return 0;
+  if(k->stable ? (*pte & PTE_W) != 0 : pagerefs[PFN(k->pa)] != 1)
+    return 0;
+  return pte;
+}
+
+// Point *pte, a private page, at the read-only frame pa instead.
+static void
+merge(pte_t *pte, uint pa)
+{
+  uint old;
+
+  old = PTE_ADDR(*pte);
+  *pte = pa | (PTE_FLAGS(*pte) & ~PTE_W) | PTE_OW;
+  pagerefs[PFN(pa)]++;
+  kfree(P2V(old));
+  ksm.nmerge++;
+  vmcount(VM_KSMMERGE, 1);
+}
+
+// Try to merge the page at va of p, which the caller has
+// checked is a private idle page.
+static void
+ksmpage(struct proc *p, uint va, pte_t *pte)
+{
+  struct kpage *k, *next;
+  pte_t *kpte;
+  uint hash;
+  char *mem;
+
+  mem = P2V(PTE_ADDR(*pte));
+  hash = pagehash((uint*)mem);
+  ksm.nscan++;
+  for(k = ksm.bucket[hash % NKBUCKET]; k; k = next){
+    next = k->next;
+    if(k->hash != hash)
+      continue;
+    if(k->p == p && k->va == va)
+      return;
+    if(k->p->pid != k->pid){
+      kpageremove(k);
+      continue;
+    }
+    if(!swappable(k->p))
+      continue;
+    if((kpte = kpagepte(k)) == 0){
+      kpageremove(k);
+      continue;
+    }
+    if(memcmp(mem, P2V(k->pa), PGSIZE) != 0)
+      continue;
+    if(k->stable && pagerefs[PFN(k->pa)] >= KSMMAXREF)
+      continue;  // full: the page can start another stable frame
+    if(!k->stable){
+      *kpte = (*kpte & ~PTE_W) | PTE_OW;
+      k->stable = 1;
+    }
+    merge(pte, k->pa);
+    return;
+  }
+  if((k = kpageinsert(hash)) == 0)
+    return;
+  k->pa = PTE_ADDR(*pte);
+  k->p = p;
+  k->pid = p->pid;
+  k->va = va;
+  k->stable = 0;
+}
+
+// Called from an idle CPU's scheduler loop with no locks held.
+void
+ksmscan(void)
+{
+  struct proc *p;
+  pte_t *pte;
+  uint va;
+  int n, np;
+
+  if(ticks - ksm.last < KSMPERIOD)
+    return;
+  ksm.last = ticks;
+  lockptable();
+  n = np = 0;
+  while(n < KSMBATCH && np <= NPROC){
+    p = procslot(ksm.handproc);
+    va = ksm.handva;
+    if(!p->mergeable || !swappable(p) || va >= p->sz){
+      ksm.handproc = (ksm.handproc + 1) % NPROC;
+      ksm.handva = 0;
+      np++;
+      continue;
+    }
+    ksm.handva = va + PGSIZE;
+    n++;
+    if((pte = walkpgdir(p->pgdir, (void*)va, 0)) == 0){
+      ksm.handva = PGADDR(PDX(va) + 1, 0, 0);
+      continue;
+    }
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) ||
+       !(*pte & (PTE_W|PTE_OW)) || (*pte & PTE_A) ||
+       PTEAGE(*pte) == 0 || pagerefs[PFN(PTE_ADDR(*pte))] != 1)
+      continue;
+    ksmpage(p, va, pte);
+  }
+  unlockptable();
+}
+
+// Print merging statistics. Runs on ^P; no lock to avoid
+// wedging a stuck machine further.
+void
+ksmdump(void)
+{
+  struct kpage *k;
+  uint nshared, nsaved;
+
+  nshared = nsaved = 0;
+  for(k = ksm.page; k < &ksm.page[NKPAGE]; k++){
+    if(k->stable && k->pa && pagerefs[PFN(k->pa)] > 1){
+      nshared++;
+      nsaved += pagerefs[PFN(k->pa)] - 1;
+    }
+  }
+  cprintf("ksm: %d frames shared, %d pages saved, %d merges, %d scanned\n",
+          nshared, nsaved, ksm.nmerge, ksm.nscan);
+}
@@ -1,6 +1,7 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -9,8 +10,8 @@
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
+// calls. The logging system only commits a transaction when
+// no FS system calls in it are active. Thus there is never
 // any reasoning required about whether a commit might
 // write an uncommitted system call's updates to disk.
 //
@@ -18,7 +19,27 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until a commit or checkpoint makes room.
+//
+// Two transactions can be in memory at once: the running one,
+// which system calls join, and one being committed (group
+// commit). A commit first copies its blocks out of the buffer
+// cache, with begin_op() held off just for that, and then
+// writes the copies to the log while system calls carry on in
+// the next transaction. Transactions that finish while a commit
+// is being written are committed together right after it.
+// fsync() waits for the commit of everything that has ended.
+//
+// Only metadata is logged: writei() writes the data of regular
+// files in place before the transaction that allocated its blocks
+// commits (ordered mode), and balloc() leaves freed blocks alone
+// while reusing them for data could go wrong (log_busy).
+//
+// Committed transactions stay in the log, one after another,
+// until a kernel thread (logflush) installs them at their home
+// locations: once the log is half full, or when begin_op()
+// runs out of room. Until then the buffer cache keeps their
+// blocks pinned, so the home locations are never read stale.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -27,7 +48,9 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Log appends are synchronous, but the blocks of a commit are
+// written to the log together, and a checkpoint writes all the
+// home locations together.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -36,49 +59,139 @@ struct logheader {
   int block[LOGSIZE];
 };
 
+// A transaction in memory.
+struct trans {
+  uint seq;
+  int outstanding;            // how many FS sys calls are executing.
+  int n;
+  int block[LOGSIZE];         // home block numbers
+  struct buf *buf[LOGSIZE];   // pinned cache buffers
+  struct buf *copy[LOGSIZE];  // copies being committed
+  uchar *freed;               // bitmap of blocks freed, by bfree()
+  uint flo, fhi;              // bytes of freed that may be set
+};
+
 struct log {
   struct spinlock lock;
   int start;
   int size;
-  int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
   int dev;
-  struct logheader lh;
+  struct trans run;   // joined by begin_op()
+  struct trans com;   // being committed
+  int committing;     // com is in use
+  int freezing;       // com's blocks are being copied, please wait.
+  uint durable;       // seq of the last committed transaction
+  int flush;          // logflush has work
+
+  // Committed blocks in the log, not yet installed.
+  int ndisk;
+  struct buf *dbuf[LOGSIZE];
+  struct buf *dcopy[LOGSIZE];
+
+  struct sleeplock wlock;     // held while writing the log; protects lh
+  struct logheader lh;        // the on-disk header
+  struct buf copies[LOGSIZE];
+  struct buf *freecopy;
+  uint nfreed;        // bytes in each freed bitmap
 };
 struct log log;
 
 static void recover_from_log(void);
 static void commit();
+static void logflush(void);
 
 void
 initlog(int dev)
 {
+  struct buf *c;
+  int order;
+
   if (sizeof(struct logheader) >= BSIZE)
     panic("initlog: too big logheader");
 
   struct superblock sb;
   initlock(&log.lock, "log");
+  initsleeplock(&log.wlock, "logw");
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+  log.nfreed = (sb.size + 7) / 8;
+  for(order = 0; (PGSIZE << order) < log.nfreed; order++)
+    ;
+  if((log.run.freed = (uchar*)kalloc_pages(order)) == 0 ||
+     (log.com.freed = (uchar*)kalloc_pages(order)) == 0)
+    panic("initlog: freed");
+  memset(log.run.freed, 0, log.nfreed);
+  memset(log.com.freed, 0, log.nfreed);
+  for(c = log.copies; c < &log.copies[LOGSIZE]; c++){
+    initsleeplock(&c->lock, "logcopy");
+    c->next = log.freecopy;
+    log.freecopy = c;
+  }
   recover_from_log();
+  log.run.seq = 1;
+  if(kthread("logflush", logflush) < 0)
+    panic("initlog: logflush");
+}
+
+static int
+inlist(int *block, int n, uint b)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(block[i] == b)
+      return 1;
+  return 0;
+}
+
+// Write the locked bufs cv[0..n) to the home locations of the
+// log blocks with the same indexes, skipping blocks that a later
+// transaction in the log logged again, and unlock them.
+static void
+install(struct buf **cv, int n)
+{
+  struct buf *c;
+  int tail, nv;
+
+  nv = 0;
+  for (tail = 0; tail < n; tail++) {
+    c = cv[tail];
+    if(inlist(&log.lh.block[tail+1], n-tail-1, log.lh.block[tail])){
+      releasesleep(&c->lock);  // a later copy wins
+      continue;
+    }
+    c->dev = log.dev;
+    c->blockno = log.lh.block[tail];
+    c->flags = B_DIRTY;
+    cv[nv++] = c;
+  }
+  if(nv > 0)
+    iderwv(cv, nv);  // write dst to disk
+  for (tail = 0; tail < nv; tail++)
+    releasesleep(&cv[tail]->lock);
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location,
+// reading the whole log at once into the copies.
 static void
 install_trans(void)
 {
+  struct buf *c, *cv[LOGSIZE];
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+    c = &log.copies[tail];
+    acquiresleep(&c->lock);
+    c->dev = log.dev;
+    c->blockno = log.start+tail+1; // log block
+    c->flags = 0;
+    cv[tail] = c;
   }
+  if(log.lh.n > 0)
+    iderwv(cv, log.lh.n);  // read log blocks
+  install(cv, log.lh.n);
 }
 
 // Read the log header from disk into the in-memory log header
@@ -121,19 +234,38 @@ recover_from_log(void)
   write_head(); // clear the log
 }
 
+// Log slots not taken by committed or committing blocks.
+// Caller holds log.lock.
+static int
+logroom(void)
+{
+  return log.size - 1 - log.ndisk - (log.committing ? log.com.n : 0);
+}
+
+// Have logflush checkpoint. Caller holds log.lock.
+static void
+kickflush(void)
+{
+  log.flush = 1;
+  wakeup(&log.flush);
+}
+
 // called at the start of each FS system call.
 void
 begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.freezing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    } else if(log.run.n + (log.run.outstanding+1)*MAXOPBLOCKS > logroom()){
+      // this op might exhaust log space; wait for commit
+      // or checkpoint.
+      if(log.ndisk > 0)
+        kickflush();
       sleep(&log, &log.lock);
     } else {
-      log.outstanding += 1;
+      log.run.outstanding += 1;
       release(&log.lock);
       break;
     }
@@ -145,64 +277,219 @@ begin_op(void)
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
-  log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+  log.run.outstanding -= 1;
+  if(log.run.outstanding == 0 && log.run.n > 0 && !log.committing){
+    commit();
   } else {
     // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
+    // and decrementing log.run.outstanding has decreased
     // the amount of reserved space.
     wakeup(&log);
   }
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
+// Wait until the FS system calls that have ended are committed.
+void
+logsync(void)
+{
+  uint seq;
+
+  acquire(&log.lock);
+  if(log.run.n > 0)
+    seq = log.run.seq;
+  else if(log.committing)
+    seq = log.com.seq;
+  else
+    seq = log.durable;
+  while(log.durable < seq)
+    sleep(&log, &log.lock);
+  release(&log.lock);
+}
+
+// Write the copies of com's blocks to the log after the base
+// blocks already there, all in one go: they are consecutive on
+// the disk, so the driver merges them into few requests. Caller
+// holds log.wlock.
+static void
+write_log(int base)
+{
+  int tail;
+  struct buf *c;
+
+  for (tail = 0; tail < log.com.n; tail++) {
+    c = log.com.copy[tail];
+    acquiresleep(&c->lock);
+    c->dev = log.dev;
+    c->blockno = log.start+base+tail+1; // log block
+    c->flags = B_DIRTY;
+  }
+  iderwv(log.com.copy, log.com.n);  // write the log
+  for (tail = 0; tail < log.com.n; tail++)
+    releasesleep(&log.com.copy[tail]->lock);
+}
+
+// Commit the running transaction, and then any that finish
+// while it is being written. Called and returns with log.lock
+// held; releases it while copying and writing.
+static void
+commit()
+{
+  int i, base;
+  struct buf *b;
+  uchar *freed;
+
+  while(log.run.outstanding == 0 && log.run.n > 0 && !log.committing){
+    // The last com has committed: its freed bitmap is free.
+    freed = log.com.freed;
+    if(log.com.fhi > log.com.flo)
+      memset(freed + log.com.flo, 0, log.com.fhi - log.com.flo);
+    log.com = log.run;
+    for (i = 0; i < log.com.n; i++) {
+      log.com.copy[i] = log.freecopy;
+      log.freecopy = log.freecopy->next;
+    }
+    log.run.n = 0;
+    log.run.seq++;
+    log.run.freed = freed;
+    log.run.flo = log.run.fhi = 0;
+    log.committing = 1;
+    log.freezing = 1;
+    release(&log.lock);
+
+    // Copy the blocks while no system call can change them.
+    for (i = 0; i < log.com.n; i++) {
+      b = bread(log.dev, log.com.block[i]);
+      memmove(log.com.copy[i]->data, b->data, BSIZE);
+      brelse(b);
+    }
     acquire(&log.lock);
-    log.committing = 0;
+    log.freezing = 0;
     wakeup(&log);
     release(&log.lock);
+
+    acquiresleep(&log.wlock);
+    base = log.lh.n;
+    write_log(base);     // Write the copies to the log
+    for (i = 0; i < log.com.n; i++)
+      log.lh.block[base+i] = log.com.block[i];
+    log.lh.n = base + log.com.n;
+    write_head();        // Write header to disk -- the real commit
+
+    acquire(&log.lock);
+    for (i = 0; i < log.com.n; i++) {
+      log.dbuf[base+i] = log.com.buf[i];
+      log.dcopy[base+i] = log.com.copy[i];
+    }
+    log.ndisk = log.lh.n;
+    log.durable = log.com.seq;
+    log.committing = 0;
+    if(log.ndisk > log.size/2)
+      kickflush();
+    wakeup(&log);
+    releasesleep(&log.wlock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Install the committed transactions at their home locations,
+// from the copies, in one batch, and erase them from the log.
+// The cache may hold newer versions of the blocks by now; those
+// belong to later transactions.
 static void
-write_log(void)
+checkpoint(void)
 {
-  int tail;
+  int tail, n;
+  struct buf *cv[LOGSIZE];
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  acquiresleep(&log.wlock);
+  n = log.lh.n;
+  for (tail = 0; tail < n; tail++) {
+    cv[tail] = log.dcopy[tail];
+    acquiresleep(&cv[tail]->lock);
+  }
+  install(cv, n);
+  log.lh.n = 0;
+  write_head();    // Erase the transactions from the log
+
+  acquire(&log.lock);
+  for (tail = 0; tail < n; tail++) {
+    bunpin(log.dbuf[tail]);
+    log.dcopy[tail]->next = log.freecopy;
+    log.freecopy = log.dcopy[tail];
   }
+  log.ndisk = 0;
+  wakeup(&log);
+  release(&log.lock);
+  releasesleep(&log.wlock);
 }
 
+// Block b was freed by the running transaction.
+void
+log_free(uint b)
+{
+  if(b/8 >= log.nfreed)
+    panic("log_free");
+  acquire(&log.lock);
+  log.run.freed[b/8] |= 1 << (b%8);
+  if(log.run.fhi == 0 || b/8 < log.run.flo)
+    log.run.flo = b/8;
+  if(b/8 >= log.run.fhi)
+    log.run.fhi = b/8 + 1;
+  release(&log.lock);
+}
+
+// May free block b not be reused yet? File data is written in
+// place, so a block must not be given to a file while a crash
+// could still undo its freeing (the transaction that freed it has
+// not committed) or while an older logged copy of it could still
+// be installed on top of the new data (it is in the log).
+int
+log_busy(uint b)
+{
+  int busy;
+
+  acquire(&log.lock);
+  busy = (log.run.freed[b/8] & (1 << (b%8))) ||
+    inlist(log.run.block, log.run.n, b) ||
+    inlist(log.lh.block, log.ndisk, b);
+  if(log.committing)
+    busy = busy || (log.com.freed[b/8] & (1 << (b%8))) ||
+      inlist(log.com.block, log.com.n, b);
+  release(&log.lock);
+  return busy;
+}
+
+// Wait for the transaction being committed, if any, and install
+// everything committed, so that log_busy() lets go of all but
+// the running transaction's blocks. Safe inside an FS system
+// call: neither waits for the running transaction to end.
+void
+log_drain(void)
+{
+  acquire(&log.lock);
+  while(log.committing)
+    sleep(&log, &log.lock);
+  release(&log.lock);
+  checkpoint();
+}
+
+// Body of the logflush kernel thread.
 static void
-commit()
+logflush(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  for(;;){
+    acquire(&log.lock);
+    while(!log.flush)
+      sleep(&log.flush, &log.lock);
+    log.flush = 0;
+    release(&log.lock);
+    checkpoint();
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
-// Record the block number and pin in the cache with B_DIRTY.
+// Record the block number and pin it in the cache.
 // commit()/write_log() will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
@@ -215,20 +502,22 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.run.n >= LOGSIZE || log.run.n >= log.size - 1)
     panic("too big a transaction");
-  if (log.outstanding < 1)
+  if (log.run.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
+  for (i = 0; i < log.run.n; i++) {
+    if (log.run.block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
-  b->flags |= B_DIRTY; // prevent eviction
+  if (i == log.run.n) {
+    log.run.block[i] = b->blockno;
+    log.run.buf[i] = b;
+    log.run.n++;
+    bpin(b); // prevent eviction until installed
+  }
   release(&log.lock);
 }
 
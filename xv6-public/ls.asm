@@ -0,0 +1,1475 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 41 05 00 00       	call   583 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 48 10 00 00       	push   $0x1048
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 2f 05 00 00       	call   583 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 00 20 00 00       	push   $0x2000
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 00 20 00 00       	add    $0x2000,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 ac 04 00 00       	call   5c3 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 a7 04 00 00       	call   5db <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 50 04 00 00       	call   5ab <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 28 10 00 00       	push   $0x1028
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 7c 05 00 00       	call   720 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 89 03 00 00       	call   59b <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 28 10 00 00       	push   $0x1028
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 72 04 00 00       	call   720 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 00 10 00 00       	push   $0x1000
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 50 04 00 00       	call   720 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 35 10 00 00       	push   $0x1035
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 31 04 00 00       	call   720 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 14 10 00 00       	push   $0x1014
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 10 04 00 00       	call   720 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 93 02 00 00       	call   5ab <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 14 10 00 00       	push   $0x1014
+ 331:	6a 01                	push   $0x1
+ 333:	e8 e8 03 00 00       	call   720 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 1e 01 00 00       	call   59b <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 f1 00 00 00       	call   5c3 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 f4 00 00 00       	call   5db <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 ba 00 00 00       	call   5ab <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+
+0000057b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 57b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <exit>:
+SYSCALL(exit)
+ 583:	b8 02 00 00 00       	mov    $0x2,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <wait>:
+SYSCALL(wait)
+ 58b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <pipe>:
+SYSCALL(pipe)
+ 593:	b8 04 00 00 00       	mov    $0x4,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <read>:
+SYSCALL(read)
+ 59b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <write>:
+SYSCALL(write)
+ 5a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <close>:
+SYSCALL(close)
+ 5ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <kill>:
+SYSCALL(kill)
+ 5b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <exec>:
+SYSCALL(exec)
+ 5bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <open>:
+SYSCALL(open)
+ 5c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mknod>:
+SYSCALL(mknod)
+ 5cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <unlink>:
+SYSCALL(unlink)
+ 5d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <fstat>:
+SYSCALL(fstat)
+ 5db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <link>:
+SYSCALL(link)
+ 5e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <mkdir>:
+SYSCALL(mkdir)
+ 5eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <chdir>:
+SYSCALL(chdir)
+ 5f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <dup>:
+SYSCALL(dup)
+ 5fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getpid>:
+SYSCALL(getpid)
+ 603:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <sbrk>:
+SYSCALL(sbrk)
+ 60b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <sleep>:
+SYSCALL(sleep)
+ 613:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <uptime>:
+SYSCALL(uptime)
+ 61b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <wmap>:
+SYSCALL(wmap)
+ 623:	b8 16 00 00 00       	mov    $0x16,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <wunmap>:
+SYSCALL(wunmap)
+ 62b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <va2pa>:
+SYSCALL(va2pa)
+ 633:	b8 18 00 00 00       	mov    $0x18,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 63b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <getwssinfo>:
+SYSCALL(getwssinfo)
+ 643:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <setmergeable>:
+SYSCALL(setmergeable)
+ 64b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <getvmstat>:
+SYSCALL(getvmstat)
+ 653:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <getfaulthist>:
+SYSCALL(getfaulthist)
+ 65b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getprocinfo>:
+SYSCALL(getprocinfo)
+ 663:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <spawn>:
+SYSCALL(spawn)
+ 66b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <fsync>:
+SYSCALL(fsync)
+ 673:	b8 20 00 00 00       	mov    $0x20,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+ 67b:	66 90                	xchg   %ax,%ax
+ 67d:	66 90                	xchg   %ax,%ax
+ 67f:	90                   	nop
+
+00000680 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 688:	89 d1                	mov    %edx,%ecx
+{
+ 68a:	83 ec 3c             	sub    $0x3c,%esp
+ 68d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 690:	85 d2                	test   %edx,%edx
+ 692:	0f 89 80 00 00 00    	jns    718 <printint+0x98>
+ 698:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 69c:	74 7a                	je     718 <printint+0x98>
+    x = -xx;
+ 69e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6a8:	31 f6                	xor    %esi,%esi
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6b0:	89 c8                	mov    %ecx,%eax
+ 6b2:	31 d2                	xor    %edx,%edx
+ 6b4:	89 f7                	mov    %esi,%edi
+ 6b6:	f7 f3                	div    %ebx
+ 6b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6bb:	0f b6 92 ac 10 00 00 	movzbl 0x10ac(%edx),%edx
+ 6c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6c6:	89 ca                	mov    %ecx,%edx
+ 6c8:	89 c1                	mov    %eax,%ecx
+ 6ca:	39 da                	cmp    %ebx,%edx
+ 6cc:	73 e2                	jae    6b0 <printint+0x30>
+  if(neg)
+ 6ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6d1:	85 c0                	test   %eax,%eax
+ 6d3:	74 07                	je     6dc <printint+0x5c>
+    buf[i++] = '-';
+ 6d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6da:	89 f7                	mov    %esi,%edi
+ 6dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6e2:	01 df                	add    %ebx,%edi
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6f4:	6a 01                	push   $0x1
+ 6f6:	50                   	push   %eax
+ 6f7:	56                   	push   %esi
+ 6f8:	e8 a6 fe ff ff       	call   5a3 <write>
+  while(--i >= 0)
+ 6fd:	89 f8                	mov    %edi,%eax
+ 6ff:	83 c4 10             	add    $0x10,%esp
+ 702:	83 ef 01             	sub    $0x1,%edi
+ 705:	39 d8                	cmp    %ebx,%eax
+ 707:	75 df                	jne    6e8 <printint+0x68>
+}
+ 709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 70c:	5b                   	pop    %ebx
+ 70d:	5e                   	pop    %esi
+ 70e:	5f                   	pop    %edi
+ 70f:	5d                   	pop    %ebp
+ 710:	c3                   	ret
+ 711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 718:	31 c0                	xor    %eax,%eax
+ 71a:	eb 89                	jmp    6a5 <printint+0x25>
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 729:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 72c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 72f:	0f b6 1e             	movzbl (%esi),%ebx
+ 732:	83 c6 01             	add    $0x1,%esi
+ 735:	84 db                	test   %bl,%bl
+ 737:	74 67                	je     7a0 <printf+0x80>
+ 739:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 73c:	31 d2                	xor    %edx,%edx
+ 73e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 741:	eb 34                	jmp    777 <printf+0x57>
+ 743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 747:	90                   	nop
+ 748:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 74b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 750:	83 f8 25             	cmp    $0x25,%eax
+ 753:	74 18                	je     76d <printf+0x4d>
+  write(fd, &c, 1);
+ 755:	83 ec 04             	sub    $0x4,%esp
+ 758:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 75b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75e:	6a 01                	push   $0x1
+ 760:	50                   	push   %eax
+ 761:	57                   	push   %edi
+ 762:	e8 3c fe ff ff       	call   5a3 <write>
+ 767:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 76a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 76d:	0f b6 1e             	movzbl (%esi),%ebx
+ 770:	83 c6 01             	add    $0x1,%esi
+ 773:	84 db                	test   %bl,%bl
+ 775:	74 29                	je     7a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 777:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 77a:	85 d2                	test   %edx,%edx
+ 77c:	74 ca                	je     748 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 77e:	83 fa 25             	cmp    $0x25,%edx
+ 781:	75 ea                	jne    76d <printf+0x4d>
+      if(c == 'd'){
+ 783:	83 f8 25             	cmp    $0x25,%eax
+ 786:	0f 84 24 01 00 00    	je     8b0 <printf+0x190>
+ 78c:	83 e8 63             	sub    $0x63,%eax
+ 78f:	83 f8 15             	cmp    $0x15,%eax
+ 792:	77 1c                	ja     7b0 <printf+0x90>
+ 794:	ff 24 85 54 10 00 00 	jmp    *0x1054(,%eax,4)
+ 79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7a3:	5b                   	pop    %ebx
+ 7a4:	5e                   	pop    %esi
+ 7a5:	5f                   	pop    %edi
+ 7a6:	5d                   	pop    %ebp
+ 7a7:	c3                   	ret
+ 7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ba:	6a 01                	push   $0x1
+ 7bc:	52                   	push   %edx
+ 7bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7c0:	57                   	push   %edi
+ 7c1:	e8 dd fd ff ff       	call   5a3 <write>
+ 7c6:	83 c4 0c             	add    $0xc,%esp
+ 7c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7cc:	6a 01                	push   $0x1
+ 7ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7d1:	52                   	push   %edx
+ 7d2:	57                   	push   %edi
+ 7d3:	e8 cb fd ff ff       	call   5a3 <write>
+        putc(fd, c);
+ 7d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7db:	31 d2                	xor    %edx,%edx
+ 7dd:	eb 8e                	jmp    76d <printf+0x4d>
+ 7df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7eb:	8b 13                	mov    (%ebx),%edx
+ 7ed:	6a 00                	push   $0x0
+ 7ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7f4:	e8 87 fe ff ff       	call   680 <printint>
+        ap++;
+ 7f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 67 ff ff ff       	jmp    76d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 810:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 813:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 815:	83 c0 04             	add    $0x4,%eax
+ 818:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 81b:	85 db                	test   %ebx,%ebx
+ 81d:	0f 84 9d 00 00 00    	je     8c0 <printf+0x1a0>
+        while(*s != 0){
+ 823:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 826:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 828:	84 c0                	test   %al,%al
+ 82a:	0f 84 3d ff ff ff    	je     76d <printf+0x4d>
+ 830:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 833:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 836:	89 de                	mov    %ebx,%esi
+ 838:	89 d3                	mov    %edx,%ebx
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 846:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 849:	6a 01                	push   $0x1
+ 84b:	53                   	push   %ebx
+ 84c:	57                   	push   %edi
+ 84d:	e8 51 fd ff ff       	call   5a3 <write>
+        while(*s != 0){
+ 852:	0f b6 06             	movzbl (%esi),%eax
+ 855:	83 c4 10             	add    $0x10,%esp
+ 858:	84 c0                	test   %al,%al
+ 85a:	75 e4                	jne    840 <printf+0x120>
+      state = 0;
+ 85c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 85f:	31 d2                	xor    %edx,%edx
+ 861:	e9 07 ff ff ff       	jmp    76d <printf+0x4d>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 01                	push   $0x1
+ 87f:	e9 6b ff ff ff       	jmp    7ef <printf+0xcf>
+ 884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 888:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 88b:	83 ec 04             	sub    $0x4,%esp
+ 88e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 891:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 893:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 896:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	52                   	push   %edx
+ 89c:	57                   	push   %edi
+ 89d:	e8 01 fd ff ff       	call   5a3 <write>
+        ap++;
+ 8a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8a8:	31 d2                	xor    %edx,%edx
+ 8aa:	e9 be fe ff ff       	jmp    76d <printf+0x4d>
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	e9 11 ff ff ff       	jmp    7d1 <printf+0xb1>
+ 8c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8c5:	bb 4a 10 00 00       	mov    $0x104a,%ebx
+ 8ca:	e9 61 ff ff ff       	jmp    830 <printf+0x110>
+ 8cf:	90                   	nop
+
+000008d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d1:	a1 10 20 00 00       	mov    0x2010,%eax
+{
+ 8d6:	89 e5                	mov    %esp,%ebp
+ 8d8:	57                   	push   %edi
+ 8d9:	56                   	push   %esi
+ 8da:	53                   	push   %ebx
+ 8db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ec:	39 ca                	cmp    %ecx,%edx
+ 8ee:	73 30                	jae    920 <free+0x50>
+ 8f0:	39 c1                	cmp    %eax,%ecx
+ 8f2:	72 04                	jb     8f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f4:	39 c2                	cmp    %eax,%edx
+ 8f6:	72 f0                	jb     8e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8fe:	39 f8                	cmp    %edi,%eax
+ 900:	74 2e                	je     930 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 902:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 905:	8b 42 04             	mov    0x4(%edx),%eax
+ 908:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 90b:	39 f1                	cmp    %esi,%ecx
+ 90d:	74 38                	je     947 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 90f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 911:	5b                   	pop    %ebx
+  freep = p;
+ 912:	89 15 10 20 00 00    	mov    %edx,0x2010
+}
+ 918:	5e                   	pop    %esi
+ 919:	5f                   	pop    %edi
+ 91a:	5d                   	pop    %ebp
+ 91b:	c3                   	ret
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 920:	39 c1                	cmp    %eax,%ecx
+ 922:	72 d0                	jb     8f4 <free+0x24>
+ 924:	eb c2                	jmp    8e8 <free+0x18>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 930:	03 70 04             	add    0x4(%eax),%esi
+ 933:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 936:	8b 02                	mov    (%edx),%eax
+ 938:	8b 00                	mov    (%eax),%eax
+ 93a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 93d:	8b 42 04             	mov    0x4(%edx),%eax
+ 940:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 943:	39 f1                	cmp    %esi,%ecx
+ 945:	75 c8                	jne    90f <free+0x3f>
+    p->s.size += bp->s.size;
+ 947:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 94a:	89 15 10 20 00 00    	mov    %edx,0x2010
+    p->s.size += bp->s.size;
+ 950:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 953:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 956:	89 0a                	mov    %ecx,(%edx)
+}
+ 958:	5b                   	pop    %ebx
+ 959:	5e                   	pop    %esi
+ 95a:	5f                   	pop    %edi
+ 95b:	5d                   	pop    %ebp
+ 95c:	c3                   	ret
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000960 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 969:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 96c:	8b 15 10 20 00 00    	mov    0x2010,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 972:	8d 78 07             	lea    0x7(%eax),%edi
+ 975:	c1 ef 03             	shr    $0x3,%edi
+ 978:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 97b:	85 d2                	test   %edx,%edx
+ 97d:	0f 84 8d 00 00 00    	je     a10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 983:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 985:	8b 48 04             	mov    0x4(%eax),%ecx
+ 988:	39 f9                	cmp    %edi,%ecx
+ 98a:	73 64                	jae    9f0 <malloc+0x90>
+  if(nu < 4096)
+ 98c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 991:	39 df                	cmp    %ebx,%edi
+ 993:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 996:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 99d:	eb 0a                	jmp    9a9 <malloc+0x49>
+ 99f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9a5:	39 f9                	cmp    %edi,%ecx
+ 9a7:	73 47                	jae    9f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9a9:	89 c2                	mov    %eax,%edx
+ 9ab:	39 05 10 20 00 00    	cmp    %eax,0x2010
+ 9b1:	75 ed                	jne    9a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9b3:	83 ec 0c             	sub    $0xc,%esp
+ 9b6:	56                   	push   %esi
+ 9b7:	e8 4f fc ff ff       	call   60b <sbrk>
+  if(p == (char*)-1)
+ 9bc:	83 c4 10             	add    $0x10,%esp
+ 9bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9c2:	74 1c                	je     9e0 <malloc+0x80>
+  hp->s.size = nu;
+ 9c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9c7:	83 ec 0c             	sub    $0xc,%esp
+ 9ca:	83 c0 08             	add    $0x8,%eax
+ 9cd:	50                   	push   %eax
+ 9ce:	e8 fd fe ff ff       	call   8d0 <free>
+  return freep;
+ 9d3:	8b 15 10 20 00 00    	mov    0x2010,%edx
+      if((p = morecore(nunits)) == 0)
+ 9d9:	83 c4 10             	add    $0x10,%esp
+ 9dc:	85 d2                	test   %edx,%edx
+ 9de:	75 c0                	jne    9a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 9e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9e3:	31 c0                	xor    %eax,%eax
+}
+ 9e5:	5b                   	pop    %ebx
+ 9e6:	5e                   	pop    %esi
+ 9e7:	5f                   	pop    %edi
+ 9e8:	5d                   	pop    %ebp
+ 9e9:	c3                   	ret
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9f0:	39 cf                	cmp    %ecx,%edi
+ 9f2:	74 4c                	je     a40 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9f4:	29 f9                	sub    %edi,%ecx
+ 9f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9ff:	89 15 10 20 00 00    	mov    %edx,0x2010
+}
+ a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a08:	83 c0 08             	add    $0x8,%eax
+}
+ a0b:	5b                   	pop    %ebx
+ a0c:	5e                   	pop    %esi
+ a0d:	5f                   	pop    %edi
+ a0e:	5d                   	pop    %ebp
+ a0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a10:	c7 05 10 20 00 00 14 	movl   $0x2014,0x2010
+ a17:	20 00 00 
+    base.s.size = 0;
+ a1a:	b8 14 20 00 00       	mov    $0x2014,%eax
+    base.s.ptr = freep = prevp = &base;
+ a1f:	c7 05 14 20 00 00 14 	movl   $0x2014,0x2014
+ a26:	20 00 00 
+    base.s.size = 0;
+ a29:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ a30:	00 00 00 
+    if(p->s.size >= nunits){
+ a33:	e9 54 ff ff ff       	jmp    98c <malloc+0x2c>
+ a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a40:	8b 08                	mov    (%eax),%ecx
+ a42:	89 0a                	mov    %ecx,(%edx)
+ a44:	eb b9                	jmp    9ff <malloc+0x9f>
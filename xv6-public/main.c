@@ -27,12 +27,15 @@ main(void)
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  ksminit();       // same-page merging
   tvinit();        // trap vectors
-  binit();         // buffer cache
+  pcacheinit();    // page cache
   fileinit();      // file table
+  pipeinit();      // pipe cache
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized to memory
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
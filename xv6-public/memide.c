@@ -32,6 +32,11 @@ ideintr(void)
   // no-op
 }
 
+void
+idedump(void)
+{
+}
+
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
@@ -58,3 +63,23 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+void
+iderwv(struct buf **bv, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(bv[i]);
+}
+
+void
+idestartv(struct buf **bv, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    iderw(bv[i]);
+    bdone(bv[i]);
+  }
+}
@@ -18,7 +18,7 @@
 #define NINODES 200
 
 // Disk layout:
-// [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
+// [ boot block | sb block | log | inode blocks | free bit map | data blocks | swap ]
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
@@ -40,6 +40,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+uint emap(struct dinode *din, uint fbn);
 
 // convert to intel byte order
 ushort
@@ -101,13 +102,16 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.swapstart = xint(FSSIZE);
+  sb.nswap = xint(SWAPSIZE);
+  sb.flags = xint(FSEXTENTS ? SB_EXTENTS : 0);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
          nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
+  for(i = 0; i < FSSIZE + SWAPSIZE; i++)
     wsect(i, zeroes);
 
   memset(buf, 0, sizeof(buf));
@@ -241,6 +245,7 @@ balloc(int used)
   int i;
 
   printf("balloc: first %d blocks have been allocated\n", used);
+  assert(used <= FSSIZE);
   assert(used < BSIZE*8);
   bzero(buf, BSIZE);
   for(i = 0; i < used; i++){
@@ -267,13 +272,15 @@ iappend(uint inum, void *xp, int n)
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
   while(n > 0){
     fbn = off / BSIZE;
-    assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
+    if(FSEXTENTS){
+      x = emap(&din, fbn);
+    } else if(fbn < NDIRECT){
       if(xint(din.addrs[fbn]) == 0){
         din.addrs[fbn] = xint(freeblock++);
       }
       x = xint(din.addrs[fbn]);
     } else {
+      assert(fbn < MAXFILE);
       if(xint(din.addrs[NDIRECT]) == 0){
         din.addrs[NDIRECT] = xint(freeblock++);
       }
@@ -295,3 +302,55 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Block fbn of a file mapped by extents, allocated if it is the
+// first block past the end. Blocks are handed out in order, so a
+// file's blocks stay in one extent unless another file's come
+// between them.
+uint
+emap(struct dinode *din, uint fbn)
+{
+  char buf[BSIZE];
+  struct extent *ex, *last;
+  uint x;
+  int i, n, inblock;
+
+  ex = (struct extent*)din->addrs;
+  n = NIEXTENT;
+  last = 0;
+  inblock = 0;
+  for(i = 0; i < n && xint(ex[i].len) > 0; i++){
+    last = &ex[i];
+    if(fbn < xint(last->lbn) + xint(last->len))
+      return xint(last->pbn) + fbn - xint(last->lbn);
+    if(i == n-1 && !inblock && xint(din->addrs[NDIRECT]) != 0){
+      rsect(xint(din->addrs[NDIRECT]), buf);
+      ex = (struct extent*)buf;
+      n = NXEXTENT;
+      inblock = 1;
+      i = -1;
+    }
+  }
+  assert(fbn == (last ? xint(last->lbn) + xint(last->len) : 0));
+
+  x = freeblock++;
+  if(last && xint(last->pbn) + xint(last->len) == x){
+    last->len = xint(xint(last->len) + 1);
+  } else {
+    if(i == n && !inblock){
+      din->addrs[NDIRECT] = xint(freeblock++);
+      rsect(xint(din->addrs[NDIRECT]), buf);
+      ex = (struct extent*)buf;
+      n = NXEXTENT;
+      inblock = 1;
+      i = 0;
+    }
+    assert(i < n);
+    ex[i].lbn = xint(fbn);
+    ex[i].pbn = xint(x);
+    ex[i].len = xint(1);
+  }
+  if(inblock)
+    wsect(xint(din->addrs[NDIRECT]), buf);
+  return x;
+}
@@ -98,13 +98,28 @@ struct segdesc {
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_A           0x020   // Accessed
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
 #define PTE_OW          0x200   // Originally Writeable
+#define PTE_SW          0x400   // Swapped out (only if !PTE_P)
+#define PTE_AGE         0xC00   // Scans since last access (only if PTE_P)
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
 #define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
 
+// A swapped-out page keeps its PTE_U/PTE_W/PTE_OW bits, and
+// holds its swap slot where the physical address would be.
+#define SWAPPED(pte)    (((uint)(pte) & (PTE_P|PTE_SW)) == PTE_SW)
+#define SWAPSLOT(pte)   ((uint)(pte) >> 12)
+#define SWAPPTE(slot)   (((uint)(slot) << 12) | PTE_SW)
+
+// Age of a present user page: how many working-set scans have
+// passed since it was last accessed, up to MAXAGE (see wss.c).
+#define MAXAGE          3
+#define PTEAGE(pte)     (((uint)(pte) & PTE_AGE) >> 10)
+
 #ifndef __ASSEMBLER__
 typedef uint pte_t;
 
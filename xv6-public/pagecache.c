@@ -0,0 +1,300 @@
+// Page cache for file data.
+//
+// The contents of regular files are cached a page at a time,
+// keyed by in-memory inode and page index, in frames from
+// kalloc(). readi() copies out of the cache, writei() updates
+// it as well as writing the blocks in place, exec() maps read-only
+// program text from it (loaduvm) and the fault path maps pages
+// of file-backed wmap regions from it (filepage), so a file's
+// data is held once and what is mapped is always what read()
+// returns. The buffer cache (bio.c) is left to metadata, and to
+// data blocks only while they pass through on their way to the
+// disk.
+//
+// Each cached page holds a reference to its frame, counted in
+// pagerefs like a mapping's, so mapped pages are shared across
+// fork and can outlive their entry. Callers that use a page get
+// their own reference and drop it with kfree().
+//
+// The cache has no fixed size. It grows while free memory lasts;
+// once free memory is below RECLAIMLOW it recycles its own least
+// recently used pages, and reclaim() takes unmapped pages from it
+// before touching process memory (pcacheshrink). The pages of an
+// inode are kept until the file is truncated or the inode's
+// icache entry is recycled for another inode (pcacheinval).
+//
+// A page that exec mapped as text is not changed under running
+// programs: writing it detaches the frame from the cache, so the
+// programs keep the old contents.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NPCBUCKET 256
+#define RECLAIMLOW 64   // as in swap.c
+#define PCBATCH   16    // pages recycled at once
+
+extern unsigned char pagerefs[NPAGES];
+
+struct cpage {
+  struct inode *ip;
+  uint pgno;            // page index in the file
+  char *mem;
+  int text;             // mapped by exec
+  struct cpage *hnext;  // hash chain
+  struct cpage *inext;  // ip->pages list
+  struct cpage *lprev;  // LRU list, most recent first
+  struct cpage *lnext;
+};
+
+struct {
+  struct spinlock lock;
+  struct kmem_cache *cache;
+  struct cpage *bucket[NPCBUCKET];
+  struct cpage lru;     // list head
+  uint n;               // pages cached
+  uint nhit;
+  uint nmiss;
+  uint nshrink;         // pages given up under memory pressure
+} pcache;
+
+void
+pcacheinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+  pcache.cache = kmem_cache_create("cpage", sizeof(struct cpage));
+  pcache.lru.lnext = pcache.lru.lprev = &pcache.lru;
+}
+
+static struct cpage**
+bucketof(struct inode *ip, uint pgno)
+{
+  return &pcache.bucket[((uint)ip / sizeof(*ip) * 31 + pgno) % NPCBUCKET];
+}
+
+static struct cpage*
+lookup(struct inode *ip, uint pgno)
+{
+  struct cpage *c;
+
+  for(c = *bucketof(ip, pgno); c; c = c->hnext)
+    if(c->ip == ip && c->pgno == pgno)
+      return c;
+  return 0;
+}
+
+static void
+lruunlink(struct cpage *c)
+{
+  c->lprev->lnext = c->lnext;
+  c->lnext->lprev = c->lprev;
+}
+
+static void
+lrupush(struct cpage *c)
+{
+  c->lnext = pcache.lru.lnext;
+  c->lprev = &pcache.lru;
+  pcache.lru.lnext->lprev = c;
+  pcache.lru.lnext = c;
+}
+
+// Unlink c everywhere and drop the cache's reference to its
+// frame. Caller holds pcache.lock.
+static void
+pcremove(struct cpage *c)
+{
+  struct cpage **pp;
+
+  for(pp = bucketof(c->ip, c->pgno); *pp != c; pp = &(*pp)->hnext)
+    if(*pp == 0)
+      panic("pcremove");
+  *pp = c->hnext;
+  for(pp = &c->ip->pages; *pp != c; pp = &(*pp)->inext)
+    if(*pp == 0)
+      panic("pcremove");
+  *pp = c->inext;
+  lruunlink(c);
+  kfree(c->mem);
+  kmem_cache_free(pcache.cache, c);
+  pcache.n--;
+}
+
+// Drop up to n of the least recently used pages that nobody
+// else holds. Caller holds pcache.lock.
+static int
+shrink(int n)
+{
+  struct cpage *c, *prev;
+  int done;
+
+  done = 0;
+  for(c = pcache.lru.lprev; c != &pcache.lru && done < n; c = prev){
+    prev = c->lprev;
+    if(pagerefs[PFN(V2P(c->mem))] == 1){
+      pcremove(c);
+      done++;
+    }
+  }
+  return done;
+}
+
+// Return page pgno of regular file ip, reading it in if need
+// be, with a reference for the caller; or 0 if no memory can be
+// found for it. A text page is marked so later writes leave it
+// alone. Caller holds ip->lock.
+char*
+pcacheget(struct inode *ip, uint pgno, int text)
+{
+  struct cpage *c;
+  char *mem;
+
+  acquire(&pcache.lock);
+  if((c = lookup(ip, pgno)) != 0){
+    lruunlink(c);
+    lrupush(c);
+    c->text |= text;
+    pagerefs[PFN(V2P(c->mem))]++;
+    pcache.nhit++;
+    release(&pcache.lock);
+    return c->mem;
+  }
+  pcache.nmiss++;
+  if(kfreecount() < RECLAIMLOW)
+    pcache.nshrink += shrink(PCBATCH);
+  release(&pcache.lock);
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  if((c = kmem_cache_alloc(pcache.cache)) == 0){
+    kfree(mem);
+    return 0;
+  }
+  readipage(ip, mem, pgno*PGSIZE);
+
+  // Only holders of ip->lock add pages of ip, so there is
+  // no racing fill to check for.
+  acquire(&pcache.lock);
+  c->ip = ip;
+  c->pgno = pgno;
+  c->mem = mem;
+  c->text = text;
+  c->hnext = *bucketof(ip, pgno);
+  *bucketof(ip, pgno) = c;
+  c->inext = ip->pages;
+  ip->pages = c;
+  lrupush(c);
+  pcache.n++;
+  pagerefs[PFN(V2P(mem))]++;
+  release(&pcache.lock);
+  return mem;
+}
+
+// Is page pgno of ip cached?
+int
+pcachehas(struct inode *ip, uint pgno)
+{
+  int r;
+
+  acquire(&pcache.lock);
+  r = lookup(ip, pgno) != 0;
+  release(&pcache.lock);
+  return r;
+}
+
+// writei() is storing n bytes from src at off in ip; bring the
+// cached page holding them, if any, up to date. Caller holds
+// ip->lock.
+void
+pcachewrite(struct inode *ip, uint off, char *src, uint n)
+{
+  struct cpage *c;
+  char *mem;
+
+  acquire(&pcache.lock);
+  if((c = lookup(ip, off/PGSIZE)) == 0){
+    release(&pcache.lock);
+    return;
+  }
+  if(c->text && pagerefs[PFN(V2P(c->mem))] > 1){
+    // Running programs keep the old text.
+    pcremove(c);
+    release(&pcache.lock);
+    return;
+  }
+  mem = c->mem;
+  pagerefs[PFN(V2P(mem))]++;
+  release(&pcache.lock);
+  // src may be user memory, so copy without the lock.
+  memmove(mem + off%PGSIZE, src, n);
+  kfree(mem);
+}
+
+// Forget the cached pages of ip: it is being truncated, or its
+// icache entry reused for another inode.
+void
+pcacheinval(struct inode *ip)
+{
+  acquire(&pcache.lock);
+  while(ip->pages)
+    pcremove(ip->pages);
+  release(&pcache.lock);
+}
+
+// Forget page pgno of ip if nobody else holds it, as reclaim
+// does after unmapping it. Returns 1 if its frame was freed.
+int
+pcachedrop(struct inode *ip, uint pgno)
+{
+  struct cpage *c;
+  int done;
+
+  done = 0;
+  acquire(&pcache.lock);
+  if((c = lookup(ip, pgno)) != 0 && pagerefs[PFN(V2P(c->mem))] == 1){
+    pcremove(c);
+    done = 1;
+  }
+  release(&pcache.lock);
+  return done;
+}
+
+// Free up to n cached pages that nobody else holds, least
+// recently used first. Returns the number freed.
+int
+pcacheshrink(int n)
+{
+  int done;
+
+  acquire(&pcache.lock);
+  done = shrink(n);
+  pcache.nshrink += done;
+  release(&pcache.lock);
+  return done;
+}
+
+// Print cache usage. Runs on ^P; no lock to avoid
+// wedging a stuck machine further.
+void
+pcachedump(void)
+{
+  struct cpage *c;
+  uint mapped, text;
+
+  mapped = text = 0;
+  for(c = pcache.lru.lnext; c != &pcache.lru; c = c->lnext){
+    if(pagerefs[PFN(V2P(c->mem))] > 1)
+      mapped++;
+    if(c->text)
+      text++;
+  }
+  cprintf("pcache: %d pages, %d mapped, %d text, %d hits, %d misses, %d shrunk\n",
+          pcache.n, mapped, text, pcache.nhit, pcache.nmiss, pcache.nshrink);
+}
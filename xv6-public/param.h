@@ -8,7 +8,13 @@
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define LOGSIZE      (MAXOPBLOCKS*6)  // max data blocks in on-disk log
+#define NBUF         (LOGSIZE*2)  // minimum size of disk block cache
+#define BCACHEPCT    1  // percent of free memory for the disk block cache
+#define FSSIZE       16384  // size of the file system mkfs makes, in blocks
+#define FSEXTENTS    1  // mkfs makes a file system mapping files with extents
+#define WSSPERIOD    100  // ticks between working-set scans
+#define SWAPSIZE     16384 // size of swap area after the file system, in blocks
+#define IOSCHED      "clook"  // disk scheduler: fifo, clook or deadline
+#define MAXORDER     10  // largest physical block is 2^MAXORDER pages
 
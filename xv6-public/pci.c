@@ -0,0 +1,58 @@
+// PCI configuration space, through configuration mechanism #1
+// (an address written to port 0xCF8, then data at 0xCFC).
+// Just enough to find a device by class and read its BARs.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCI_ADDR  0xCF8
+#define PCI_DATA  0xCFC
+
+#define PCI_ID      0x00  // vendor and device
+#define PCI_CLASS   0x08  // class, subclass, prog if, revision
+#define PCI_HDRTYPE 0x0C  // header type in bits 16-23
+
+#define PCITAG(bus, dev, func) ((bus)<<16 | (dev)<<11 | (func)<<8)
+
+uint
+pciconfread(uint tag, int reg)
+{
+  outl(PCI_ADDR, 0x80000000 | tag | (reg & 0xfc));
+  return inl(PCI_DATA);
+}
+
+void
+pciconfwrite(uint tag, int reg, uint v)
+{
+  outl(PCI_ADDR, 0x80000000 | tag | (reg & 0xfc));
+  outl(PCI_DATA, v);
+}
+
+// Find the first function with the given class and subclass
+// and store its tag in *tag. Returns 0, or -1 if there is none.
+int
+pcifind(int class, int subclass, uint *tag)
+{
+  int bus, dev, func, nfunc;
+  uint t, c;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+        t = PCITAG(bus, dev, func);
+        if((pciconfread(t, PCI_ID) & 0xffff) == 0xffff)
+          continue;
+        if(func == 0 && (pciconfread(t, PCI_HDRTYPE) & 0x800000))
+          nfunc = 8;
+        c = pciconfread(t, PCI_CLASS);
+        if((c >> 24) == class && ((c >> 16) & 0xff) == subclass){
+          *tag = t;
+          return 0;
+        }
+      }
+    }
+  }
+  return -1;
+}
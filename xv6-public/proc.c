@@ -35,6 +35,26 @@ pinit(void)
   initlock(&ptable.lock, "ptable");
 }
 
+// Lock and unlock the process table, and find the i'th entry,
+// for the swapper's walk over all processes (swap.c).
+void
+lockptable(void)
+{
+  acquire(&ptable.lock);
+}
+
+void
+unlockptable(void)
+{
+  release(&ptable.lock);
+}
+
+struct proc*
+procslot(int i)
+{
+  return &ptable.proc[i];
+}
+
 // Must be called with interrupts disabled
 int
 cpuid() {
@@ -97,6 +117,12 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->preempted = 0;
+  p->mergeable = 0;
+  memset(p->pgage, 0, sizeof(p->pgage));
+  p->rss = 0;
+  p->cputicks = 0;
+  p->kfn = 0;
   for (int i = 0; i < MAX_WMMAP_INFO; i++) {
       p->mmaps[i].addr = -1;
       p->mmaps[i].length = 0;
@@ -131,6 +157,20 @@ found:
   return p;
 }
 
+// Set up tf to enter user mode at eip with stack pointer esp.
+static void
+usertf(struct trapframe *tf, uint eip, uint esp)
+{
+  memset(tf, 0, sizeof(*tf));
+  tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  tf->ds = (SEG_UDATA << 3) | DPL_USER;
+  tf->es = tf->ds;
+  tf->ss = tf->ds;
+  tf->eflags = FL_IF;
+  tf->esp = esp;
+  tf->eip = eip;
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -146,14 +186,8 @@ userinit(void)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
-  memset(p->tf, 0, sizeof(*p->tf));
-  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
-  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
-  p->tf->es = p->tf->ds;
-  p->tf->ss = p->tf->ds;
-  p->tf->eflags = FL_IF;
-  p->tf->esp = PGSIZE;
-  p->tf->eip = 0;  // beginning of initcode.S
+  p->rss = 1;
+  usertf(p->tf, 0, PGSIZE);  // beginning of initcode.S
 
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
@@ -181,7 +215,9 @@ growproc(int n)
   if(n > 0){
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
+    curproc->rss += (PGROUNDUP(sz) - PGROUNDUP(curproc->sz)) / PGSIZE;
   } else if(n < 0){
+    curproc->rss -= residentuvm(curproc->pgdir, PGROUNDUP(sz + n), sz, 0);
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
   }
@@ -213,7 +249,9 @@ fork(void)
     return -1;
   }
   np->sz = curproc->sz;
+  np->rss = curproc->rss;
   np->parent = curproc;
+  np->mergeable = curproc->mergeable;
   *np->tf = *curproc->tf;
 
   // Copy mmaps
@@ -224,10 +262,18 @@ fork(void)
       np->mmaps[i].length = p_mmaps[i].length;
       np->mmaps[i].flags = p_mmaps[i].flags;
       np->mmaps[i].file = p_mmaps[i].file;
-      np->mmaps[i].nloaded = p_mmaps[i].nloaded;
+      np->mmaps[i].hot = 0;
 
       for (int j = p_mmaps[i].addr; j < p_mmaps[i].addr + p_mmaps[i].length; j += PGSIZE) {
         pte_t *pte = walkpgdir(curproc->pgdir, (void*)j, 0);
+        // the region is shared, so bring swapped pages back first
+        if (pte && SWAPPED(*pte) && swapin(curproc->pgdir, j) < 0) {
+          freevm(np->pgdir);
+          kfree(np->kstack);
+          np->kstack = 0;
+          np->state = UNUSED;
+          return -1;
+        }
         if (pte == 0 || !(*pte & PTE_P)) continue;
         uint pa = PTE_ADDR(*pte);
         int flags = PTE_FLAGS(*pte);
@@ -236,6 +282,7 @@ fork(void)
           return -1;
         }
         pagerefs[PFN(pa)]++;
+        np->mmaps[i].nloaded++;
       }
     }
   }
@@ -261,6 +308,58 @@ fork(void)
   return pid;
 }
 
+// Create a process running the program at path with arguments
+// argv, built directly from the ELF image rather than by copying
+// the caller as fork() does. The child's file descriptor i is a
+// duplicate of the caller's fds[i] for i < nfds, or closed if
+// fds[i] is -1; it starts with no wmap regions. Returns the
+// child's pid, or -1.
+int
+spawn(char *path, char **argv, int *fds, int nfds)
+{
+  int i, pid;
+  struct image im;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if(nfds < 0 || nfds > NOFILE)
+    return -1;
+  for(i = 0; i < nfds; i++)
+    if(fds[i] != -1 &&
+       (fds[i] < 0 || fds[i] >= NOFILE || curproc->ofile[fds[i]] == 0))
+      return -1;
+
+  if(loadimage(path, argv, &im) < 0)
+    return -1;
+  if((np = allocproc()) == 0){
+    freevm(im.pgdir);
+    return -1;
+  }
+  np->pgdir = im.pgdir;
+  np->sz = im.sz;
+  np->rss = im.sz / PGSIZE;
+  np->parent = curproc;
+  np->mergeable = curproc->mergeable;
+  usertf(np->tf, im.entry, im.sp);
+
+  for(i = 0; i < nfds; i++)
+    if(fds[i] != -1)
+      np->ofile[i] = filedup(curproc->ofile[fds[i]]);
+  np->cwd = idup(curproc->cwd);
+
+  safestrcpy(np->name, im.name, sizeof(np->name));
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->state = RUNNABLE;
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -290,7 +389,11 @@ exit(void)
         if (pte == 0 || !(*pte & PTE_P)) continue;
         uint pa = PTE_ADDR(*pte);
         char* pva = P2V(pa);
-        if (file != 0) filewrite(file, pva, PGSIZE);
+        if (file != 0) {
+          // pages may have been reclaimed, so seek to each one
+          file->off = j*PGSIZE;
+          filewrite(file, pva, PGSIZE);
+        }
         kfree(pva);
         *pte = 0;
       }
@@ -389,6 +492,7 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int ran;
   c->proc = 0;
   
   for(;;){
@@ -396,10 +500,12 @@ scheduler(void)
     sti();
 
     // Loop over process table looking for process to run.
+    ran = 0;
     acquire(&ptable.lock);
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
       if(p->state != RUNNABLE)
         continue;
+      ran = 1;
 
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
@@ -417,6 +523,11 @@ scheduler(void)
     }
     release(&ptable.lock);
 
+    // Nothing to run: use the time to zero free pages.
+    if(!ran){
+      kzeroidle();
+      ksmscan();
+    }
   }
 }
 
@@ -456,6 +567,44 @@ yield(void)
   release(&ptable.lock);
 }
 
+// A kernel thread's very first scheduling by scheduler()
+// will swtch here.
+static void
+kthreadstart(void)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+  myproc()->kfn();
+  panic("kthread returned");
+}
+
+// Start a kernel thread: a child of init with no user memory
+// that runs fn, which must not return, in the kernel.
+int
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    p->state = UNUSED;
+    return -1;
+  }
+  p->sz = 0;
+  p->parent = initproc;
+  p->kfn = fn;
+  p->context->eip = (uint)kthreadstart;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+  return p->pid;
+}
+
 // A fork child's very first scheduling by scheduler()
 // will swtch here.  "Return" to user space.
 void
@@ -472,6 +621,8 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    bmapinit(ROOTDEV);
+    swapinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -561,6 +712,92 @@ kill(int pid)
   return -1;
 }
 
+// Copy the working-set estimate of process pid (the caller's
+// if pid is 0) into *wi. Returns -1 if there is no such process.
+int
+getwss(int pid, struct wssinfo *wi)
+{
+  struct proc *p;
+  int i;
+
+  if(pid == 0)
+    pid = myproc()->pid;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid != pid || p->state == UNUSED)
+      continue;
+    memset(wi, 0, sizeof(*wi));
+    wi->period = WSSPERIOD;
+    for(i = 0; i <= MAXAGE; i++){
+      wi->age[i] = p->pgage[i];
+      wi->rss += p->pgage[i];
+    }
+    wi->wss = p->pgage[0];
+    for(i = 0; i < MAX_WMMAP_INFO; i++)
+      if(p->mmaps[i].addr != -1)
+        wi->hot[i] = p->mmaps[i].hot;
+    release(&ptable.lock);
+    return 0;
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Fill pi with up to n entries describing the live processes.
+// Returns the number filled. The shared/private split is taken
+// from the page tables here, since a frame stops being shared
+// when another process lets go of it.
+int
+getprocinfo(struct procinfo *pi, int n)
+{
+  static char *states[] = {
+  [EMBRYO]    "embryo",
+  [SLEEPING]  "sleep",
+  [RUNNABLE]  "runble",
+  [RUNNING]   "run",
+  [ZOMBIE]    "zombie"
+  };
+  struct procinfo info;
+  struct proc *p;
+  struct mmap *m;
+  int i, k;
+
+  k = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && k < n; p++){
+    acquire(&ptable.lock);
+    if(p->state == UNUSED){
+      release(&ptable.lock);
+      continue;
+    }
+    memset(&info, 0, sizeof(info));
+    info.pid = p->pid;
+    info.ppid = p->parent ? p->parent->pid : 0;
+    safestrcpy(info.state, states[p->state], sizeof(info.state));
+    safestrcpy(info.name, p->name, sizeof(info.name));
+    info.sz = p->sz;
+    info.ticks = p->cputicks;
+    if(p->pgdir && p->state != ZOMBIE){
+      residentuvm(p->pgdir, 0, p->sz, &info.shared);
+      for(m = p->mmaps; m < &p->mmaps[MAX_WMMAP_INFO]; m++){
+        if(m->addr == -1)
+          continue;
+        info.wmap += m->nloaded;
+        residentuvm(p->pgdir, m->addr, m->addr + m->length, &info.shared);
+      }
+      info.rss = p->rss + info.wmap;
+      info.private = info.rss - info.shared;
+      info.pgtable = 1;
+      for(i = 0; i < NPDENTRIES; i++)
+        if(p->pgdir[i] & PTE_P)
+          info.pgtable++;
+    }
+    release(&ptable.lock);
+    // The user's buffer may fault, so fill it without the lock.
+    pi[k++] = info;
+  }
+  return k;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -1,4 +1,5 @@
 #include "wmap.h"
+#include "vmstat.h"
 
 // Per-CPU state
 struct cpu {
@@ -10,6 +11,8 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  uint vmevent[NVMEVENT];      // VM event counts (see vmcount.c)
+  uint faulthist[NFAULTCLASS][NFAULTBUCKET]; // Fault latencies
 };
 
 extern struct cpu cpus[NCPU];
@@ -21,6 +24,7 @@ struct mmap {
     int flags;
     struct file *file;
     int nloaded;
+    int hot;
 };
 
 //PAGEBREAK: 17
@@ -56,12 +60,27 @@ struct proc {
   struct context *context;                 // swtch() here to run process
   void *chan;                              // If non-zero, sleeping on chan
   int killed;                              // If non-zero, have been killed
+  int preempted;                           // Preempted in user mode (see swap.c)
+  int mergeable;                           // Pages may be merged (see ksm.c)
+  int pgage[MAXAGE+1];                     // Resident pages by age at last scan (see wss.c)
+  int rss;                                 // Resident pages of the image (wmap ones: mmaps[].nloaded)
+  uint cputicks;                           // Timer ticks spent running
+  void (*kfn)(void);                       // Body of a kernel thread, or 0
   struct file *ofile[NOFILE];              // Open files
   struct inode *cwd;                       // Current directory
   char name[16];                           // Process name (debugging)
   struct mmap mmaps[MAX_WMMAP_INFO];       // Process memory maps
 };
 
+// A program loaded by loadimage() (exec.c) but not yet run.
+struct image {
+  pde_t *pgdir;
+  uint sz;
+  uint entry;                // initial eip
+  uint sp;                   // initial esp, with argv pushed
+  char *name;                // last element of the path
+};
+
 // Process memory is laid out contiguously, low addresses first:
 //   text
 //   original data and bss
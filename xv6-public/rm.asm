@@ -0,0 +1,1210 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(unlink(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 cf 02 00 00       	call   313 <unlink>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 14 10 00 00       	push   $0x1014
+  53:	6a 02                	push   $0x2
+  55:	e8 06 04 00 00       	call   460 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 61 02 00 00       	call   2c3 <exit>
+    printf(2, "Usage: rm files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 00 10 00 00       	push   $0x1000
+  69:	6a 02                	push   $0x2
+  6b:	e8 f0 03 00 00       	call   460 <printf>
+    exit();
+  70:	e8 4e 02 00 00       	call   2c3 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 1e 01 00 00       	call   2db <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 f1 00 00 00       	call   303 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 f4 00 00 00       	call   31b <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 ba 00 00 00       	call   2eb <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+
+000002bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <exit>:
+SYSCALL(exit)
+ 2c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <wait>:
+SYSCALL(wait)
+ 2cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <pipe>:
+SYSCALL(pipe)
+ 2d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <read>:
+SYSCALL(read)
+ 2db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <write>:
+SYSCALL(write)
+ 2e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <close>:
+SYSCALL(close)
+ 2eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <kill>:
+SYSCALL(kill)
+ 2f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <exec>:
+SYSCALL(exec)
+ 2fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <open>:
+SYSCALL(open)
+ 303:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mknod>:
+SYSCALL(mknod)
+ 30b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <unlink>:
+SYSCALL(unlink)
+ 313:	b8 12 00 00 00       	mov    $0x12,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <fstat>:
+SYSCALL(fstat)
+ 31b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <link>:
+SYSCALL(link)
+ 323:	b8 13 00 00 00       	mov    $0x13,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mkdir>:
+SYSCALL(mkdir)
+ 32b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <chdir>:
+SYSCALL(chdir)
+ 333:	b8 09 00 00 00       	mov    $0x9,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <dup>:
+SYSCALL(dup)
+ 33b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <getpid>:
+SYSCALL(getpid)
+ 343:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <sbrk>:
+SYSCALL(sbrk)
+ 34b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <sleep>:
+SYSCALL(sleep)
+ 353:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <uptime>:
+SYSCALL(uptime)
+ 35b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <wmap>:
+SYSCALL(wmap)
+ 363:	b8 16 00 00 00       	mov    $0x16,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wunmap>:
+SYSCALL(wunmap)
+ 36b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <va2pa>:
+SYSCALL(va2pa)
+ 373:	b8 18 00 00 00       	mov    $0x18,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 37b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getwssinfo>:
+SYSCALL(getwssinfo)
+ 383:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <setmergeable>:
+SYSCALL(setmergeable)
+ 38b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <getvmstat>:
+SYSCALL(getvmstat)
+ 393:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <getfaulthist>:
+SYSCALL(getfaulthist)
+ 39b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <getprocinfo>:
+SYSCALL(getprocinfo)
+ 3a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <spawn>:
+SYSCALL(spawn)
+ 3ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <fsync>:
+SYSCALL(fsync)
+ 3b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+ 3bb:	66 90                	xchg   %ax,%ax
+ 3bd:	66 90                	xchg   %ax,%ax
+ 3bf:	90                   	nop
+
+000003c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3c8:	89 d1                	mov    %edx,%ecx
+{
+ 3ca:	83 ec 3c             	sub    $0x3c,%esp
+ 3cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3d0:	85 d2                	test   %edx,%edx
+ 3d2:	0f 89 80 00 00 00    	jns    458 <printint+0x98>
+ 3d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3dc:	74 7a                	je     458 <printint+0x98>
+    x = -xx;
+ 3de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3e8:	31 f6                	xor    %esi,%esi
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3f0:	89 c8                	mov    %ecx,%eax
+ 3f2:	31 d2                	xor    %edx,%edx
+ 3f4:	89 f7                	mov    %esi,%edi
+ 3f6:	f7 f3                	div    %ebx
+ 3f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3fb:	0f b6 92 8c 10 00 00 	movzbl 0x108c(%edx),%edx
+ 402:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 406:	89 ca                	mov    %ecx,%edx
+ 408:	89 c1                	mov    %eax,%ecx
+ 40a:	39 da                	cmp    %ebx,%edx
+ 40c:	73 e2                	jae    3f0 <printint+0x30>
+  if(neg)
+ 40e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 411:	85 c0                	test   %eax,%eax
+ 413:	74 07                	je     41c <printint+0x5c>
+    buf[i++] = '-';
+ 415:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 41a:	89 f7                	mov    %esi,%edi
+ 41c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 41f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 422:	01 df                	add    %ebx,%edi
+ 424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 428:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 42b:	83 ec 04             	sub    $0x4,%esp
+ 42e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 431:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 434:	6a 01                	push   $0x1
+ 436:	50                   	push   %eax
+ 437:	56                   	push   %esi
+ 438:	e8 a6 fe ff ff       	call   2e3 <write>
+  while(--i >= 0)
+ 43d:	89 f8                	mov    %edi,%eax
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	83 ef 01             	sub    $0x1,%edi
+ 445:	39 d8                	cmp    %ebx,%eax
+ 447:	75 df                	jne    428 <printint+0x68>
+}
+ 449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44c:	5b                   	pop    %ebx
+ 44d:	5e                   	pop    %esi
+ 44e:	5f                   	pop    %edi
+ 44f:	5d                   	pop    %ebp
+ 450:	c3                   	ret
+ 451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 458:	31 c0                	xor    %eax,%eax
+ 45a:	eb 89                	jmp    3e5 <printint+0x25>
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 469:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 46c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 46f:	0f b6 1e             	movzbl (%esi),%ebx
+ 472:	83 c6 01             	add    $0x1,%esi
+ 475:	84 db                	test   %bl,%bl
+ 477:	74 67                	je     4e0 <printf+0x80>
+ 479:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 47c:	31 d2                	xor    %edx,%edx
+ 47e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 481:	eb 34                	jmp    4b7 <printf+0x57>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 48b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 490:	83 f8 25             	cmp    $0x25,%eax
+ 493:	74 18                	je     4ad <printf+0x4d>
+  write(fd, &c, 1);
+ 495:	83 ec 04             	sub    $0x4,%esp
+ 498:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 49b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 49e:	6a 01                	push   $0x1
+ 4a0:	50                   	push   %eax
+ 4a1:	57                   	push   %edi
+ 4a2:	e8 3c fe ff ff       	call   2e3 <write>
+ 4a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b0:	83 c6 01             	add    $0x1,%esi
+ 4b3:	84 db                	test   %bl,%bl
+ 4b5:	74 29                	je     4e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ba:	85 d2                	test   %edx,%edx
+ 4bc:	74 ca                	je     488 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4be:	83 fa 25             	cmp    $0x25,%edx
+ 4c1:	75 ea                	jne    4ad <printf+0x4d>
+      if(c == 'd'){
+ 4c3:	83 f8 25             	cmp    $0x25,%eax
+ 4c6:	0f 84 24 01 00 00    	je     5f0 <printf+0x190>
+ 4cc:	83 e8 63             	sub    $0x63,%eax
+ 4cf:	83 f8 15             	cmp    $0x15,%eax
+ 4d2:	77 1c                	ja     4f0 <printf+0x90>
+ 4d4:	ff 24 85 34 10 00 00 	jmp    *0x1034(,%eax,4)
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4e3:	5b                   	pop    %ebx
+ 4e4:	5e                   	pop    %esi
+ 4e5:	5f                   	pop    %edi
+ 4e6:	5d                   	pop    %ebp
+ 4e7:	c3                   	ret
+ 4e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+  write(fd, &c, 1);
+ 4f0:	83 ec 04             	sub    $0x4,%esp
+ 4f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4fa:	6a 01                	push   $0x1
+ 4fc:	52                   	push   %edx
+ 4fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 500:	57                   	push   %edi
+ 501:	e8 dd fd ff ff       	call   2e3 <write>
+ 506:	83 c4 0c             	add    $0xc,%esp
+ 509:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 50c:	6a 01                	push   $0x1
+ 50e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 511:	52                   	push   %edx
+ 512:	57                   	push   %edi
+ 513:	e8 cb fd ff ff       	call   2e3 <write>
+        putc(fd, c);
+ 518:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 51b:	31 d2                	xor    %edx,%edx
+ 51d:	eb 8e                	jmp    4ad <printf+0x4d>
+ 51f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 520:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 523:	83 ec 0c             	sub    $0xc,%esp
+ 526:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 52b:	8b 13                	mov    (%ebx),%edx
+ 52d:	6a 00                	push   $0x0
+ 52f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 531:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 534:	e8 87 fe ff ff       	call   3c0 <printint>
+        ap++;
+ 539:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 53c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53f:	31 d2                	xor    %edx,%edx
+ 541:	e9 67 ff ff ff       	jmp    4ad <printf+0x4d>
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 550:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 553:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 555:	83 c0 04             	add    $0x4,%eax
+ 558:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 55b:	85 db                	test   %ebx,%ebx
+ 55d:	0f 84 9d 00 00 00    	je     600 <printf+0x1a0>
+        while(*s != 0){
+ 563:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 566:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 568:	84 c0                	test   %al,%al
+ 56a:	0f 84 3d ff ff ff    	je     4ad <printf+0x4d>
+ 570:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 573:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 576:	89 de                	mov    %ebx,%esi
+ 578:	89 d3                	mov    %edx,%ebx
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 586:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 589:	6a 01                	push   $0x1
+ 58b:	53                   	push   %ebx
+ 58c:	57                   	push   %edi
+ 58d:	e8 51 fd ff ff       	call   2e3 <write>
+        while(*s != 0){
+ 592:	0f b6 06             	movzbl (%esi),%eax
+ 595:	83 c4 10             	add    $0x10,%esp
+ 598:	84 c0                	test   %al,%al
+ 59a:	75 e4                	jne    580 <printf+0x120>
+      state = 0;
+ 59c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 59f:	31 d2                	xor    %edx,%edx
+ 5a1:	e9 07 ff ff ff       	jmp    4ad <printf+0x4d>
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5b3:	83 ec 0c             	sub    $0xc,%esp
+ 5b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5bb:	8b 13                	mov    (%ebx),%edx
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	e9 6b ff ff ff       	jmp    52f <printf+0xcf>
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	52                   	push   %edx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 01 fd ff ff       	call   2e3 <write>
+        ap++;
+ 5e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e8:	31 d2                	xor    %edx,%edx
+ 5ea:	e9 be fe ff ff       	jmp    4ad <printf+0x4d>
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	e9 11 ff ff ff       	jmp    511 <printf+0xb1>
+ 600:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 605:	bb 2d 10 00 00       	mov    $0x102d,%ebx
+ 60a:	e9 61 ff ff ff       	jmp    570 <printf+0x110>
+ 60f:	90                   	nop
+
+00000610 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 610:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 611:	a1 00 20 00 00       	mov    0x2000,%eax
+{
+ 616:	89 e5                	mov    %esp,%ebp
+ 618:	57                   	push   %edi
+ 619:	56                   	push   %esi
+ 61a:	53                   	push   %ebx
+ 61b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 61e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 628:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 62a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 62c:	39 ca                	cmp    %ecx,%edx
+ 62e:	73 30                	jae    660 <free+0x50>
+ 630:	39 c1                	cmp    %eax,%ecx
+ 632:	72 04                	jb     638 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 634:	39 c2                	cmp    %eax,%edx
+ 636:	72 f0                	jb     628 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 638:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 63b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 63e:	39 f8                	cmp    %edi,%eax
+ 640:	74 2e                	je     670 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 642:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 645:	8b 42 04             	mov    0x4(%edx),%eax
+ 648:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 64b:	39 f1                	cmp    %esi,%ecx
+ 64d:	74 38                	je     687 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 64f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 651:	5b                   	pop    %ebx
+  freep = p;
+ 652:	89 15 00 20 00 00    	mov    %edx,0x2000
+}
+ 658:	5e                   	pop    %esi
+ 659:	5f                   	pop    %edi
+ 65a:	5d                   	pop    %ebp
+ 65b:	c3                   	ret
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 660:	39 c1                	cmp    %eax,%ecx
+ 662:	72 d0                	jb     634 <free+0x24>
+ 664:	eb c2                	jmp    628 <free+0x18>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 670:	03 70 04             	add    0x4(%eax),%esi
+ 673:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 676:	8b 02                	mov    (%edx),%eax
+ 678:	8b 00                	mov    (%eax),%eax
+ 67a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 67d:	8b 42 04             	mov    0x4(%edx),%eax
+ 680:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 683:	39 f1                	cmp    %esi,%ecx
+ 685:	75 c8                	jne    64f <free+0x3f>
+    p->s.size += bp->s.size;
+ 687:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 68a:	89 15 00 20 00 00    	mov    %edx,0x2000
+    p->s.size += bp->s.size;
+ 690:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 693:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 696:	89 0a                	mov    %ecx,(%edx)
+}
+ 698:	5b                   	pop    %ebx
+ 699:	5e                   	pop    %esi
+ 69a:	5f                   	pop    %edi
+ 69b:	5d                   	pop    %ebp
+ 69c:	c3                   	ret
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6ac:	8b 15 00 20 00 00    	mov    0x2000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6b5:	c1 ef 03             	shr    $0x3,%edi
+ 6b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6bb:	85 d2                	test   %edx,%edx
+ 6bd:	0f 84 8d 00 00 00    	je     750 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6c8:	39 f9                	cmp    %edi,%ecx
+ 6ca:	73 64                	jae    730 <malloc+0x90>
+  if(nu < 4096)
+ 6cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6d1:	39 df                	cmp    %ebx,%edi
+ 6d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6dd:	eb 0a                	jmp    6e9 <malloc+0x49>
+ 6df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6e5:	39 f9                	cmp    %edi,%ecx
+ 6e7:	73 47                	jae    730 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6e9:	89 c2                	mov    %eax,%edx
+ 6eb:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ 6f1:	75 ed                	jne    6e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	56                   	push   %esi
+ 6f7:	e8 4f fc ff ff       	call   34b <sbrk>
+  if(p == (char*)-1)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+ 6ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 702:	74 1c                	je     720 <malloc+0x80>
+  hp->s.size = nu;
+ 704:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 707:	83 ec 0c             	sub    $0xc,%esp
+ 70a:	83 c0 08             	add    $0x8,%eax
+ 70d:	50                   	push   %eax
+ 70e:	e8 fd fe ff ff       	call   610 <free>
+  return freep;
+ 713:	8b 15 00 20 00 00    	mov    0x2000,%edx
+      if((p = morecore(nunits)) == 0)
+ 719:	83 c4 10             	add    $0x10,%esp
+ 71c:	85 d2                	test   %edx,%edx
+ 71e:	75 c0                	jne    6e0 <malloc+0x40>
+        return 0;
+  }
+}
+ 720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 723:	31 c0                	xor    %eax,%eax
+}
+ 725:	5b                   	pop    %ebx
+ 726:	5e                   	pop    %esi
+ 727:	5f                   	pop    %edi
+ 728:	5d                   	pop    %ebp
+ 729:	c3                   	ret
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 730:	39 cf                	cmp    %ecx,%edi
+ 732:	74 4c                	je     780 <malloc+0xe0>
+        p->s.size -= nunits;
+ 734:	29 f9                	sub    %edi,%ecx
+ 736:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 739:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 73c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 73f:	89 15 00 20 00 00    	mov    %edx,0x2000
+}
+ 745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 748:	83 c0 08             	add    $0x8,%eax
+}
+ 74b:	5b                   	pop    %ebx
+ 74c:	5e                   	pop    %esi
+ 74d:	5f                   	pop    %edi
+ 74e:	5d                   	pop    %ebp
+ 74f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 750:	c7 05 00 20 00 00 04 	movl   $0x2004,0x2000
+ 757:	20 00 00 
+    base.s.size = 0;
+ 75a:	b8 04 20 00 00       	mov    $0x2004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 75f:	c7 05 04 20 00 00 04 	movl   $0x2004,0x2004
+ 766:	20 00 00 
+    base.s.size = 0;
+ 769:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 770:	00 00 00 
+    if(p->s.size >= nunits){
+ 773:	e9 54 ff ff ff       	jmp    6cc <malloc+0x2c>
+ 778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 780:	8b 08                	mov    (%eax),%ecx
+ 782:	89 0a                	mov    %ecx,(%edx)
+ 784:	eb b9                	jmp    73f <malloc+0x9f>
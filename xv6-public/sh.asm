@@ -0,0 +1,2864 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  int fd;
+  struct cmd *cmd;
+  struct execcmd *ecmd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+       f:	eb 10                	jmp    21 <main+0x21>
+      11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 4b 01 00 00    	jg     16c <main+0x16c>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 a1 20 00 00       	push   $0x20a1
+      2b:	e8 43 0f 00 00       	call   f73 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+  printf(2, "$ ");
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	68 00 20 00 00       	push   $0x2000
+      48:	6a 02                	push   $0x2
+      4a:	e8 81 10 00 00       	call   10d0 <printf>
+  memset(buf, 0, nbuf);
+      4f:	83 c4 0c             	add    $0xc,%esp
+      52:	6a 64                	push   $0x64
+      54:	6a 00                	push   $0x0
+      56:	68 20 30 00 00       	push   $0x3020
+      5b:	e8 50 0d 00 00       	call   db0 <memset>
+  gets(buf, nbuf);
+      60:	58                   	pop    %eax
+      61:	5a                   	pop    %edx
+      62:	6a 64                	push   $0x64
+      64:	68 20 30 00 00       	push   $0x3020
+      69:	e8 a2 0d 00 00       	call   e10 <gets>
+  if(buf[0] == 0) // EOF
+      6e:	0f b6 05 20 30 00 00 	movzbl 0x3020,%eax
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	84 c0                	test   %al,%al
+      7a:	0f 84 e7 00 00 00    	je     167 <main+0x167>
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      80:	3c 63                	cmp    $0x63,%al
+      82:	75 09                	jne    8d <main+0x8d>
+      84:	80 3d 21 30 00 00 64 	cmpb   $0x64,0x3021
+      8b:	74 73                	je     100 <main+0x100>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      if(chdir(buf+3) < 0)
+        printf(2, "cannot cd %s\n", buf+3);
+      continue;
+    }
+    if(plaincmd(buf)){
+      8d:	83 ec 0c             	sub    $0xc,%esp
+      90:	68 20 30 00 00       	push   $0x3020
+      95:	e8 46 04 00 00       	call   4e0 <plaincmd>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	85 c0                	test   %eax,%eax
+      9f:	75 1f                	jne    c0 <main+0xc0>
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      a1:	e8 85 0e 00 00       	call   f2b <fork>
+  if(pid == -1)
+      a6:	83 f8 ff             	cmp    $0xffffffff,%eax
+      a9:	0f 84 e3 00 00 00    	je     192 <main+0x192>
+    if(fork1() == 0)
+      af:	85 c0                	test   %eax,%eax
+      b1:	0f 84 c6 00 00 00    	je     17d <main+0x17d>
+    wait();
+      b7:	e8 7f 0e 00 00       	call   f3b <wait>
+      bc:	eb 82                	jmp    40 <main+0x40>
+      be:	66 90                	xchg   %ax,%ax
+      cmd = parsecmd(buf);
+      c0:	83 ec 0c             	sub    $0xc,%esp
+      c3:	68 20 30 00 00       	push   $0x3020
+      c8:	e8 b3 0b 00 00       	call   c80 <parsecmd>
+      if(spawn(ecmd->argv[0], ecmd->argv, 0, 0) < 0)
+      cd:	6a 00                	push   $0x0
+      cmd = parsecmd(buf);
+      cf:	89 c3                	mov    %eax,%ebx
+      if(spawn(ecmd->argv[0], ecmd->argv, 0, 0) < 0)
+      d1:	8d 40 04             	lea    0x4(%eax),%eax
+      d4:	6a 00                	push   $0x0
+      d6:	50                   	push   %eax
+      d7:	ff 73 04             	push   0x4(%ebx)
+      da:	e8 3c 0f 00 00       	call   101b <spawn>
+      df:	83 c4 20             	add    $0x20,%esp
+      e2:	85 c0                	test   %eax,%eax
+      e4:	78 6a                	js     150 <main+0x150>
+        wait();
+      e6:	e8 50 0e 00 00       	call   f3b <wait>
+      free(cmd);
+      eb:	83 ec 0c             	sub    $0xc,%esp
+      ee:	53                   	push   %ebx
+      ef:	e8 8c 11 00 00       	call   1280 <free>
+      continue;
+      f4:	83 c4 10             	add    $0x10,%esp
+      f7:	e9 44 ff ff ff       	jmp    40 <main+0x40>
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     100:	80 3d 22 30 00 00 20 	cmpb   $0x20,0x3022
+     107:	75 84                	jne    8d <main+0x8d>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     109:	83 ec 0c             	sub    $0xc,%esp
+     10c:	68 20 30 00 00       	push   $0x3020
+     111:	e8 6a 0c 00 00       	call   d80 <strlen>
+      if(chdir(buf+3) < 0)
+     116:	c7 04 24 23 30 00 00 	movl   $0x3023,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+     11d:	c6 80 1f 30 00 00 00 	movb   $0x0,0x301f(%eax)
+      if(chdir(buf+3) < 0)
+     124:	e8 7a 0e 00 00       	call   fa3 <chdir>
+     129:	83 c4 10             	add    $0x10,%esp
+     12c:	85 c0                	test   %eax,%eax
+     12e:	0f 89 0c ff ff ff    	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf+3);
+     134:	51                   	push   %ecx
+     135:	68 23 30 00 00       	push   $0x3023
+     13a:	68 a9 20 00 00       	push   $0x20a9
+     13f:	6a 02                	push   $0x2
+     141:	e8 8a 0f 00 00       	call   10d0 <printf>
+     146:	83 c4 10             	add    $0x10,%esp
+     149:	e9 f2 fe ff ff       	jmp    40 <main+0x40>
+     14e:	66 90                	xchg   %ax,%ax
+        printf(2, "exec %s failed\n", ecmd->argv[0]);
+     150:	83 ec 04             	sub    $0x4,%esp
+     153:	ff 73 04             	push   0x4(%ebx)
+     156:	68 0f 20 00 00       	push   $0x200f
+     15b:	6a 02                	push   $0x2
+     15d:	e8 6e 0f 00 00       	call   10d0 <printf>
+     162:	83 c4 10             	add    $0x10,%esp
+     165:	eb 84                	jmp    eb <main+0xeb>
+  exit();
+     167:	e8 c7 0d 00 00       	call   f33 <exit>
+      close(fd);
+     16c:	83 ec 0c             	sub    $0xc,%esp
+     16f:	50                   	push   %eax
+     170:	e8 e6 0d 00 00       	call   f5b <close>
+      break;
+     175:	83 c4 10             	add    $0x10,%esp
+     178:	e9 c3 fe ff ff       	jmp    40 <main+0x40>
+      runcmd(parsecmd(buf));
+     17d:	83 ec 0c             	sub    $0xc,%esp
+     180:	68 20 30 00 00       	push   $0x3020
+     185:	e8 f6 0a 00 00       	call   c80 <parsecmd>
+     18a:	89 04 24             	mov    %eax,(%esp)
+     18d:	e8 8e 00 00 00       	call   220 <runcmd>
+    panic("fork");
+     192:	83 ec 0c             	sub    $0xc,%esp
+     195:	68 03 20 00 00       	push   $0x2003
+     19a:	e8 41 00 00 00       	call   1e0 <panic>
+     19f:	90                   	nop
+
+000001a0 <getcmd>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	56                   	push   %esi
+     1a4:	53                   	push   %ebx
+     1a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     1ab:	83 ec 08             	sub    $0x8,%esp
+     1ae:	68 00 20 00 00       	push   $0x2000
+     1b3:	6a 02                	push   $0x2
+     1b5:	e8 16 0f 00 00       	call   10d0 <printf>
+  memset(buf, 0, nbuf);
+     1ba:	83 c4 0c             	add    $0xc,%esp
+     1bd:	56                   	push   %esi
+     1be:	6a 00                	push   $0x0
+     1c0:	53                   	push   %ebx
+     1c1:	e8 ea 0b 00 00       	call   db0 <memset>
+  gets(buf, nbuf);
+     1c6:	58                   	pop    %eax
+     1c7:	5a                   	pop    %edx
+     1c8:	56                   	push   %esi
+     1c9:	53                   	push   %ebx
+     1ca:	e8 41 0c 00 00       	call   e10 <gets>
+  if(buf[0] == 0) // EOF
+     1cf:	83 c4 10             	add    $0x10,%esp
+     1d2:	80 3b 01             	cmpb   $0x1,(%ebx)
+     1d5:	19 c0                	sbb    %eax,%eax
+}
+     1d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1da:	5b                   	pop    %ebx
+     1db:	5e                   	pop    %esi
+     1dc:	5d                   	pop    %ebp
+     1dd:	c3                   	ret
+     1de:	66 90                	xchg   %ax,%ax
+
+000001e0 <panic>:
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     1e6:	ff 75 08             	push   0x8(%ebp)
+     1e9:	68 9d 20 00 00       	push   $0x209d
+     1ee:	6a 02                	push   $0x2
+     1f0:	e8 db 0e 00 00       	call   10d0 <printf>
+  exit();
+     1f5:	e8 39 0d 00 00       	call   f33 <exit>
+     1fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000200 <fork1>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     206:	e8 20 0d 00 00       	call   f2b <fork>
+  if(pid == -1)
+     20b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     20e:	74 02                	je     212 <fork1+0x12>
+  return pid;
+}
+     210:	c9                   	leave
+     211:	c3                   	ret
+    panic("fork");
+     212:	83 ec 0c             	sub    $0xc,%esp
+     215:	68 03 20 00 00       	push   $0x2003
+     21a:	e8 c1 ff ff ff       	call   1e0 <panic>
+     21f:	90                   	nop
+
+00000220 <runcmd>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	53                   	push   %ebx
+     224:	83 ec 14             	sub    $0x14,%esp
+     227:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     22a:	85 db                	test   %ebx,%ebx
+     22c:	74 42                	je     270 <runcmd+0x50>
+  switch(cmd->type){
+     22e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     231:	0f 87 e3 00 00 00    	ja     31a <runcmd+0xfa>
+     237:	8b 03                	mov    (%ebx),%eax
+     239:	ff 24 85 b8 20 00 00 	jmp    *0x20b8(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     240:	8b 43 04             	mov    0x4(%ebx),%eax
+     243:	85 c0                	test   %eax,%eax
+     245:	74 29                	je     270 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     247:	8d 53 04             	lea    0x4(%ebx),%edx
+     24a:	51                   	push   %ecx
+     24b:	51                   	push   %ecx
+     24c:	52                   	push   %edx
+     24d:	50                   	push   %eax
+     24e:	e8 18 0d 00 00       	call   f6b <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     253:	83 c4 0c             	add    $0xc,%esp
+     256:	ff 73 04             	push   0x4(%ebx)
+     259:	68 0f 20 00 00       	push   $0x200f
+     25e:	6a 02                	push   $0x2
+     260:	e8 6b 0e 00 00       	call   10d0 <printf>
+    break;
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26f:	90                   	nop
+    exit();
+     270:	e8 be 0c 00 00       	call   f33 <exit>
+    if(fork1() == 0)
+     275:	e8 86 ff ff ff       	call   200 <fork1>
+     27a:	85 c0                	test   %eax,%eax
+     27c:	75 f2                	jne    270 <runcmd+0x50>
+     27e:	e9 8c 00 00 00       	jmp    30f <runcmd+0xef>
+    if(pipe(p) < 0)
+     283:	83 ec 0c             	sub    $0xc,%esp
+     286:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     289:	50                   	push   %eax
+     28a:	e8 b4 0c 00 00       	call   f43 <pipe>
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	85 c0                	test   %eax,%eax
+     294:	0f 88 a2 00 00 00    	js     33c <runcmd+0x11c>
+    if(fork1() == 0){
+     29a:	e8 61 ff ff ff       	call   200 <fork1>
+     29f:	85 c0                	test   %eax,%eax
+     2a1:	0f 84 a2 00 00 00    	je     349 <runcmd+0x129>
+    if(fork1() == 0){
+     2a7:	e8 54 ff ff ff       	call   200 <fork1>
+     2ac:	85 c0                	test   %eax,%eax
+     2ae:	0f 84 c3 00 00 00    	je     377 <runcmd+0x157>
+    close(p[0]);
+     2b4:	83 ec 0c             	sub    $0xc,%esp
+     2b7:	ff 75 f0             	push   -0x10(%ebp)
+     2ba:	e8 9c 0c 00 00       	call   f5b <close>
+    close(p[1]);
+     2bf:	58                   	pop    %eax
+     2c0:	ff 75 f4             	push   -0xc(%ebp)
+     2c3:	e8 93 0c 00 00       	call   f5b <close>
+    wait();
+     2c8:	e8 6e 0c 00 00       	call   f3b <wait>
+    wait();
+     2cd:	e8 69 0c 00 00       	call   f3b <wait>
+    break;
+     2d2:	83 c4 10             	add    $0x10,%esp
+     2d5:	eb 99                	jmp    270 <runcmd+0x50>
+    if(fork1() == 0)
+     2d7:	e8 24 ff ff ff       	call   200 <fork1>
+     2dc:	85 c0                	test   %eax,%eax
+     2de:	74 2f                	je     30f <runcmd+0xef>
+    wait();
+     2e0:	e8 56 0c 00 00       	call   f3b <wait>
+    runcmd(lcmd->right);
+     2e5:	83 ec 0c             	sub    $0xc,%esp
+     2e8:	ff 73 08             	push   0x8(%ebx)
+     2eb:	e8 30 ff ff ff       	call   220 <runcmd>
+    close(rcmd->fd);
+     2f0:	83 ec 0c             	sub    $0xc,%esp
+     2f3:	ff 73 14             	push   0x14(%ebx)
+     2f6:	e8 60 0c 00 00       	call   f5b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     2fb:	58                   	pop    %eax
+     2fc:	5a                   	pop    %edx
+     2fd:	ff 73 10             	push   0x10(%ebx)
+     300:	ff 73 08             	push   0x8(%ebx)
+     303:	e8 6b 0c 00 00       	call   f73 <open>
+     308:	83 c4 10             	add    $0x10,%esp
+     30b:	85 c0                	test   %eax,%eax
+     30d:	78 18                	js     327 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     30f:	83 ec 0c             	sub    $0xc,%esp
+     312:	ff 73 04             	push   0x4(%ebx)
+     315:	e8 06 ff ff ff       	call   220 <runcmd>
+    panic("runcmd");
+     31a:	83 ec 0c             	sub    $0xc,%esp
+     31d:	68 08 20 00 00       	push   $0x2008
+     322:	e8 b9 fe ff ff       	call   1e0 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     327:	51                   	push   %ecx
+     328:	ff 73 08             	push   0x8(%ebx)
+     32b:	68 1f 20 00 00       	push   $0x201f
+     330:	6a 02                	push   $0x2
+     332:	e8 99 0d 00 00       	call   10d0 <printf>
+      exit();
+     337:	e8 f7 0b 00 00       	call   f33 <exit>
+      panic("pipe");
+     33c:	83 ec 0c             	sub    $0xc,%esp
+     33f:	68 2f 20 00 00       	push   $0x202f
+     344:	e8 97 fe ff ff       	call   1e0 <panic>
+      close(1);
+     349:	83 ec 0c             	sub    $0xc,%esp
+     34c:	6a 01                	push   $0x1
+     34e:	e8 08 0c 00 00       	call   f5b <close>
+      dup(p[1]);
+     353:	58                   	pop    %eax
+     354:	ff 75 f4             	push   -0xc(%ebp)
+     357:	e8 4f 0c 00 00       	call   fab <dup>
+      close(p[0]);
+     35c:	58                   	pop    %eax
+     35d:	ff 75 f0             	push   -0x10(%ebp)
+     360:	e8 f6 0b 00 00       	call   f5b <close>
+      close(p[1]);
+     365:	58                   	pop    %eax
+     366:	ff 75 f4             	push   -0xc(%ebp)
+     369:	e8 ed 0b 00 00       	call   f5b <close>
+      runcmd(pcmd->left);
+     36e:	5a                   	pop    %edx
+     36f:	ff 73 04             	push   0x4(%ebx)
+     372:	e8 a9 fe ff ff       	call   220 <runcmd>
+      close(0);
+     377:	83 ec 0c             	sub    $0xc,%esp
+     37a:	6a 00                	push   $0x0
+     37c:	e8 da 0b 00 00       	call   f5b <close>
+      dup(p[0]);
+     381:	5a                   	pop    %edx
+     382:	ff 75 f0             	push   -0x10(%ebp)
+     385:	e8 21 0c 00 00       	call   fab <dup>
+      close(p[0]);
+     38a:	59                   	pop    %ecx
+     38b:	ff 75 f0             	push   -0x10(%ebp)
+     38e:	e8 c8 0b 00 00       	call   f5b <close>
+      close(p[1]);
+     393:	58                   	pop    %eax
+     394:	ff 75 f4             	push   -0xc(%ebp)
+     397:	e8 bf 0b 00 00       	call   f5b <close>
+      runcmd(pcmd->right);
+     39c:	58                   	pop    %eax
+     39d:	ff 73 08             	push   0x8(%ebx)
+     3a0:	e8 7b fe ff ff       	call   220 <runcmd>
+     3a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	53                   	push   %ebx
+     3b4:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3b7:	6a 54                	push   $0x54
+     3b9:	e8 52 0f 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3be:	83 c4 0c             	add    $0xc,%esp
+     3c1:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     3c3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3c5:	6a 00                	push   $0x0
+     3c7:	50                   	push   %eax
+     3c8:	e8 e3 09 00 00       	call   db0 <memset>
+  cmd->type = EXEC;
+     3cd:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     3d3:	89 d8                	mov    %ebx,%eax
+     3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3d8:	c9                   	leave
+     3d9:	c3                   	ret
+     3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003e0 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	53                   	push   %ebx
+     3e4:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3e7:	6a 18                	push   $0x18
+     3e9:	e8 22 0f 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3ee:	83 c4 0c             	add    $0xc,%esp
+     3f1:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     3f3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3f5:	6a 00                	push   $0x0
+     3f7:	50                   	push   %eax
+     3f8:	e8 b3 09 00 00       	call   db0 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     3fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     400:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     406:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     409:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     40f:	8b 45 10             	mov    0x10(%ebp),%eax
+     412:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     415:	8b 45 14             	mov    0x14(%ebp),%eax
+     418:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     41b:	8b 45 18             	mov    0x18(%ebp),%eax
+     41e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     421:	89 d8                	mov    %ebx,%eax
+     423:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     426:	c9                   	leave
+     427:	c3                   	ret
+     428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+00000430 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     437:	6a 0c                	push   $0xc
+     439:	e8 d2 0e 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     43e:	83 c4 0c             	add    $0xc,%esp
+     441:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     443:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     445:	6a 00                	push   $0x0
+     447:	50                   	push   %eax
+     448:	e8 63 09 00 00       	call   db0 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     44d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     450:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     456:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     459:	8b 45 0c             	mov    0xc(%ebp),%eax
+     45c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     45f:	89 d8                	mov    %ebx,%eax
+     461:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     464:	c9                   	leave
+     465:	c3                   	ret
+     466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	53                   	push   %ebx
+     474:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     477:	6a 0c                	push   $0xc
+     479:	e8 92 0e 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     47e:	83 c4 0c             	add    $0xc,%esp
+     481:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     483:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     485:	6a 00                	push   $0x0
+     487:	50                   	push   %eax
+     488:	e8 23 09 00 00       	call   db0 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     48d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     490:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     496:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     499:	8b 45 0c             	mov    0xc(%ebp),%eax
+     49c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     49f:	89 d8                	mov    %ebx,%eax
+     4a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a4:	c9                   	leave
+     4a5:	c3                   	ret
+     4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	53                   	push   %ebx
+     4b4:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4b7:	6a 08                	push   $0x8
+     4b9:	e8 52 0e 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     4be:	83 c4 0c             	add    $0xc,%esp
+     4c1:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     4c3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     4c5:	6a 00                	push   $0x0
+     4c7:	50                   	push   %eax
+     4c8:	e8 e3 08 00 00       	call   db0 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     4cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     4d0:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     4d6:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     4d9:	89 d8                	mov    %ebx,%eax
+     4db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4de:	c9                   	leave
+     4df:	c3                   	ret
+
+000004e0 <plaincmd>:
+// Is buf a lone command with no redirections, pipes, lists or
+// background jobs, and few enough words that parsecmd() cannot
+// fail on it?
+int
+plaincmd(char *buf)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	57                   	push   %edi
+     4e4:	56                   	push   %esi
+     4e5:	53                   	push   %ebx
+     4e6:	83 ec 0c             	sub    $0xc,%esp
+     4e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  char *s;
+  int n;
+
+  n = 0;
+  for(s = buf; *s; s++){
+     4ec:	0f be 07             	movsbl (%edi),%eax
+     4ef:	84 c0                	test   %al,%al
+     4f1:	0f 84 89 00 00 00    	je     580 <plaincmd+0xa0>
+     4f7:	89 fb                	mov    %edi,%ebx
+  n = 0;
+     4f9:	31 f6                	xor    %esi,%esi
+     4fb:	eb 0e                	jmp    50b <plaincmd+0x2b>
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(s = buf; *s; s++){
+     500:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+     504:	83 c3 01             	add    $0x1,%ebx
+     507:	84 c0                	test   %al,%al
+     509:	74 58                	je     563 <plaincmd+0x83>
+    if(strchr(symbols, *s))
+     50b:	83 ec 08             	sub    $0x8,%esp
+     50e:	50                   	push   %eax
+     50f:	68 00 30 00 00       	push   $0x3000
+     514:	e8 b7 08 00 00       	call   dd0 <strchr>
+     519:	83 c4 10             	add    $0x10,%esp
+     51c:	85 c0                	test   %eax,%eax
+     51e:	75 60                	jne    580 <plaincmd+0xa0>
+      return 0;
+    if(!strchr(whitespace, *s) && (s == buf || strchr(whitespace, s[-1])))
+     520:	0f be 03             	movsbl (%ebx),%eax
+     523:	83 ec 08             	sub    $0x8,%esp
+     526:	50                   	push   %eax
+     527:	68 08 30 00 00       	push   $0x3008
+     52c:	e8 9f 08 00 00       	call   dd0 <strchr>
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	75 c8                	jne    500 <plaincmd+0x20>
+     538:	39 df                	cmp    %ebx,%edi
+     53a:	74 19                	je     555 <plaincmd+0x75>
+     53c:	0f be 43 ff          	movsbl -0x1(%ebx),%eax
+     540:	83 ec 08             	sub    $0x8,%esp
+     543:	50                   	push   %eax
+     544:	68 08 30 00 00       	push   $0x3008
+     549:	e8 82 08 00 00       	call   dd0 <strchr>
+     54e:	83 c4 10             	add    $0x10,%esp
+     551:	85 c0                	test   %eax,%eax
+     553:	74 ab                	je     500 <plaincmd+0x20>
+  for(s = buf; *s; s++){
+     555:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+     559:	83 c3 01             	add    $0x1,%ebx
+      n++;
+     55c:	83 c6 01             	add    $0x1,%esi
+  for(s = buf; *s; s++){
+     55f:	84 c0                	test   %al,%al
+     561:	75 a8                	jne    50b <plaincmd+0x2b>
+  }
+  return n > 0 && n < MAXARGS;
+     563:	83 ee 01             	sub    $0x1,%esi
+     566:	31 c0                	xor    %eax,%eax
+     568:	83 fe 08             	cmp    $0x8,%esi
+     56b:	0f 96 c0             	setbe  %al
+}
+     56e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     571:	5b                   	pop    %ebx
+     572:	5e                   	pop    %esi
+     573:	5f                   	pop    %edi
+     574:	5d                   	pop    %ebp
+     575:	c3                   	ret
+     576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57d:	8d 76 00             	lea    0x0(%esi),%esi
+     580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+     583:	31 c0                	xor    %eax,%eax
+}
+     585:	5b                   	pop    %ebx
+     586:	5e                   	pop    %esi
+     587:	5f                   	pop    %edi
+     588:	5d                   	pop    %ebp
+     589:	c3                   	ret
+     58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <gettoken>:
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     599:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     59c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     59f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     5a2:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     5a4:	39 df                	cmp    %ebx,%edi
+     5a6:	72 0f                	jb     5b7 <gettoken+0x27>
+     5a8:	eb 25                	jmp    5cf <gettoken+0x3f>
+     5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     5b0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     5b3:	39 fb                	cmp    %edi,%ebx
+     5b5:	74 18                	je     5cf <gettoken+0x3f>
+     5b7:	0f be 07             	movsbl (%edi),%eax
+     5ba:	83 ec 08             	sub    $0x8,%esp
+     5bd:	50                   	push   %eax
+     5be:	68 08 30 00 00       	push   $0x3008
+     5c3:	e8 08 08 00 00       	call   dd0 <strchr>
+     5c8:	83 c4 10             	add    $0x10,%esp
+     5cb:	85 c0                	test   %eax,%eax
+     5cd:	75 e1                	jne    5b0 <gettoken+0x20>
+  if(q)
+     5cf:	85 f6                	test   %esi,%esi
+     5d1:	74 02                	je     5d5 <gettoken+0x45>
+    *q = s;
+     5d3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     5d5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     5d8:	3c 3c                	cmp    $0x3c,%al
+     5da:	0f 8f d0 00 00 00    	jg     6b0 <gettoken+0x120>
+     5e0:	3c 3a                	cmp    $0x3a,%al
+     5e2:	0f 8f bc 00 00 00    	jg     6a4 <gettoken+0x114>
+     5e8:	84 c0                	test   %al,%al
+     5ea:	75 44                	jne    630 <gettoken+0xa0>
+     5ec:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     5ee:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     5f1:	85 c9                	test   %ecx,%ecx
+     5f3:	74 05                	je     5fa <gettoken+0x6a>
+    *eq = s;
+     5f5:	8b 45 14             	mov    0x14(%ebp),%eax
+     5f8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     5fa:	39 df                	cmp    %ebx,%edi
+     5fc:	72 09                	jb     607 <gettoken+0x77>
+     5fe:	eb 1f                	jmp    61f <gettoken+0x8f>
+    s++;
+     600:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     603:	39 fb                	cmp    %edi,%ebx
+     605:	74 18                	je     61f <gettoken+0x8f>
+     607:	0f be 07             	movsbl (%edi),%eax
+     60a:	83 ec 08             	sub    $0x8,%esp
+     60d:	50                   	push   %eax
+     60e:	68 08 30 00 00       	push   $0x3008
+     613:	e8 b8 07 00 00       	call   dd0 <strchr>
+     618:	83 c4 10             	add    $0x10,%esp
+     61b:	85 c0                	test   %eax,%eax
+     61d:	75 e1                	jne    600 <gettoken+0x70>
+  *ps = s;
+     61f:	8b 45 08             	mov    0x8(%ebp),%eax
+     622:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     627:	89 f0                	mov    %esi,%eax
+     629:	5b                   	pop    %ebx
+     62a:	5e                   	pop    %esi
+     62b:	5f                   	pop    %edi
+     62c:	5d                   	pop    %ebp
+     62d:	c3                   	ret
+     62e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     630:	79 66                	jns    698 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     632:	39 df                	cmp    %ebx,%edi
+     634:	72 39                	jb     66f <gettoken+0xdf>
+  if(eq)
+     636:	8b 55 14             	mov    0x14(%ebp),%edx
+     639:	85 d2                	test   %edx,%edx
+     63b:	0f 84 b3 00 00 00    	je     6f4 <gettoken+0x164>
+    *eq = s;
+     641:	8b 45 14             	mov    0x14(%ebp),%eax
+     644:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     646:	e9 a9 00 00 00       	jmp    6f4 <gettoken+0x164>
+     64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     650:	0f be 07             	movsbl (%edi),%eax
+     653:	83 ec 08             	sub    $0x8,%esp
+     656:	50                   	push   %eax
+     657:	68 00 30 00 00       	push   $0x3000
+     65c:	e8 6f 07 00 00       	call   dd0 <strchr>
+     661:	83 c4 10             	add    $0x10,%esp
+     664:	85 c0                	test   %eax,%eax
+     666:	75 1f                	jne    687 <gettoken+0xf7>
+      s++;
+     668:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     66b:	39 fb                	cmp    %edi,%ebx
+     66d:	74 77                	je     6e6 <gettoken+0x156>
+     66f:	0f be 07             	movsbl (%edi),%eax
+     672:	83 ec 08             	sub    $0x8,%esp
+     675:	50                   	push   %eax
+     676:	68 08 30 00 00       	push   $0x3008
+     67b:	e8 50 07 00 00       	call   dd0 <strchr>
+     680:	83 c4 10             	add    $0x10,%esp
+     683:	85 c0                	test   %eax,%eax
+     685:	74 c9                	je     650 <gettoken+0xc0>
+    ret = 'a';
+     687:	be 61 00 00 00       	mov    $0x61,%esi
+     68c:	e9 5d ff ff ff       	jmp    5ee <gettoken+0x5e>
+     691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     698:	3c 26                	cmp    $0x26,%al
+     69a:	74 08                	je     6a4 <gettoken+0x114>
+     69c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     69f:	80 f9 01             	cmp    $0x1,%cl
+     6a2:	77 8e                	ja     632 <gettoken+0xa2>
+  ret = *s;
+     6a4:	0f be f0             	movsbl %al,%esi
+    s++;
+     6a7:	83 c7 01             	add    $0x1,%edi
+    break;
+     6aa:	e9 3f ff ff ff       	jmp    5ee <gettoken+0x5e>
+     6af:	90                   	nop
+  switch(*s){
+     6b0:	3c 3e                	cmp    $0x3e,%al
+     6b2:	75 1c                	jne    6d0 <gettoken+0x140>
+    if(*s == '>'){
+     6b4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     6b8:	74 1f                	je     6d9 <gettoken+0x149>
+    s++;
+     6ba:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     6bd:	be 3e 00 00 00       	mov    $0x3e,%esi
+     6c2:	e9 27 ff ff ff       	jmp    5ee <gettoken+0x5e>
+     6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ce:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     6d0:	3c 7c                	cmp    $0x7c,%al
+     6d2:	74 d0                	je     6a4 <gettoken+0x114>
+     6d4:	e9 59 ff ff ff       	jmp    632 <gettoken+0xa2>
+      s++;
+     6d9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     6dc:	be 2b 00 00 00       	mov    $0x2b,%esi
+     6e1:	e9 08 ff ff ff       	jmp    5ee <gettoken+0x5e>
+  if(eq)
+     6e6:	8b 45 14             	mov    0x14(%ebp),%eax
+     6e9:	85 c0                	test   %eax,%eax
+     6eb:	74 05                	je     6f2 <gettoken+0x162>
+    *eq = s;
+     6ed:	8b 45 14             	mov    0x14(%ebp),%eax
+     6f0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     6f2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     6f4:	be 61 00 00 00       	mov    $0x61,%esi
+     6f9:	e9 21 ff ff ff       	jmp    61f <gettoken+0x8f>
+     6fe:	66 90                	xchg   %ax,%ax
+
+00000700 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	57                   	push   %edi
+     704:	56                   	push   %esi
+     705:	53                   	push   %ebx
+     706:	83 ec 0c             	sub    $0xc,%esp
+     709:	8b 7d 08             	mov    0x8(%ebp),%edi
+     70c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     70f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     711:	39 f3                	cmp    %esi,%ebx
+     713:	72 12                	jb     727 <peek+0x27>
+     715:	eb 28                	jmp    73f <peek+0x3f>
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+    s++;
+     720:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     723:	39 de                	cmp    %ebx,%esi
+     725:	74 18                	je     73f <peek+0x3f>
+     727:	0f be 03             	movsbl (%ebx),%eax
+     72a:	83 ec 08             	sub    $0x8,%esp
+     72d:	50                   	push   %eax
+     72e:	68 08 30 00 00       	push   $0x3008
+     733:	e8 98 06 00 00       	call   dd0 <strchr>
+     738:	83 c4 10             	add    $0x10,%esp
+     73b:	85 c0                	test   %eax,%eax
+     73d:	75 e1                	jne    720 <peek+0x20>
+  *ps = s;
+     73f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     741:	0f be 03             	movsbl (%ebx),%eax
+     744:	31 d2                	xor    %edx,%edx
+     746:	84 c0                	test   %al,%al
+     748:	75 0e                	jne    758 <peek+0x58>
+}
+     74a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     74d:	89 d0                	mov    %edx,%eax
+     74f:	5b                   	pop    %ebx
+     750:	5e                   	pop    %esi
+     751:	5f                   	pop    %edi
+     752:	5d                   	pop    %ebp
+     753:	c3                   	ret
+     754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     758:	83 ec 08             	sub    $0x8,%esp
+     75b:	50                   	push   %eax
+     75c:	ff 75 10             	push   0x10(%ebp)
+     75f:	e8 6c 06 00 00       	call   dd0 <strchr>
+     764:	83 c4 10             	add    $0x10,%esp
+     767:	31 d2                	xor    %edx,%edx
+     769:	85 c0                	test   %eax,%eax
+     76b:	0f 95 c2             	setne  %dl
+}
+     76e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     771:	5b                   	pop    %ebx
+     772:	89 d0                	mov    %edx,%eax
+     774:	5e                   	pop    %esi
+     775:	5f                   	pop    %edi
+     776:	5d                   	pop    %ebp
+     777:	c3                   	ret
+     778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+     784:	56                   	push   %esi
+     785:	53                   	push   %ebx
+     786:	83 ec 2c             	sub    $0x2c,%esp
+     789:	8b 75 0c             	mov    0xc(%ebp),%esi
+     78c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     78f:	90                   	nop
+     790:	83 ec 04             	sub    $0x4,%esp
+     793:	68 51 20 00 00       	push   $0x2051
+     798:	53                   	push   %ebx
+     799:	56                   	push   %esi
+     79a:	e8 61 ff ff ff       	call   700 <peek>
+     79f:	83 c4 10             	add    $0x10,%esp
+     7a2:	85 c0                	test   %eax,%eax
+     7a4:	0f 84 f6 00 00 00    	je     8a0 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     7aa:	6a 00                	push   $0x0
+     7ac:	6a 00                	push   $0x0
+     7ae:	53                   	push   %ebx
+     7af:	56                   	push   %esi
+     7b0:	e8 db fd ff ff       	call   590 <gettoken>
+     7b5:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     7b7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     7ba:	50                   	push   %eax
+     7bb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     7be:	50                   	push   %eax
+     7bf:	53                   	push   %ebx
+     7c0:	56                   	push   %esi
+     7c1:	e8 ca fd ff ff       	call   590 <gettoken>
+     7c6:	83 c4 20             	add    $0x20,%esp
+     7c9:	83 f8 61             	cmp    $0x61,%eax
+     7cc:	0f 85 d9 00 00 00    	jne    8ab <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     7d2:	83 ff 3c             	cmp    $0x3c,%edi
+     7d5:	74 69                	je     840 <parseredirs+0xc0>
+     7d7:	83 ff 3e             	cmp    $0x3e,%edi
+     7da:	74 05                	je     7e1 <parseredirs+0x61>
+     7dc:	83 ff 2b             	cmp    $0x2b,%edi
+     7df:	75 af                	jne    790 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     7e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     7e4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     7e7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     7ea:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     7ed:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     7f0:	6a 18                	push   $0x18
+     7f2:	e8 19 0b 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7f7:	83 c4 0c             	add    $0xc,%esp
+     7fa:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     7fc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     7fe:	6a 00                	push   $0x0
+     800:	50                   	push   %eax
+     801:	e8 aa 05 00 00       	call   db0 <memset>
+  cmd->type = REDIR;
+     806:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     80c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     80f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     812:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     815:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     818:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     81b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     81e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     825:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     828:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     82f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     832:	e9 59 ff ff ff       	jmp    790 <parseredirs+0x10>
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     840:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     843:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     846:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     849:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     84c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     84f:	6a 18                	push   $0x18
+     851:	e8 ba 0a 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     856:	83 c4 0c             	add    $0xc,%esp
+     859:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     85b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     85d:	6a 00                	push   $0x0
+     85f:	50                   	push   %eax
+     860:	e8 4b 05 00 00       	call   db0 <memset>
+  cmd->cmd = subcmd;
+     865:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     868:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     86b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     86e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     871:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     877:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     87a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     87d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     880:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     883:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     88a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     891:	e9 fa fe ff ff       	jmp    790 <parseredirs+0x10>
+     896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     8a0:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a6:	5b                   	pop    %ebx
+     8a7:	5e                   	pop    %esi
+     8a8:	5f                   	pop    %edi
+     8a9:	5d                   	pop    %ebp
+     8aa:	c3                   	ret
+      panic("missing file for redirection");
+     8ab:	83 ec 0c             	sub    $0xc,%esp
+     8ae:	68 34 20 00 00       	push   $0x2034
+     8b3:	e8 28 f9 ff ff       	call   1e0 <panic>
+     8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8bf:	90                   	nop
+
+000008c0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 30             	sub    $0x30,%esp
+     8c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     8cf:	68 54 20 00 00       	push   $0x2054
+     8d4:	56                   	push   %esi
+     8d5:	53                   	push   %ebx
+     8d6:	e8 25 fe ff ff       	call   700 <peek>
+     8db:	83 c4 10             	add    $0x10,%esp
+     8de:	85 c0                	test   %eax,%eax
+     8e0:	0f 85 aa 00 00 00    	jne    990 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     8e6:	83 ec 0c             	sub    $0xc,%esp
+     8e9:	89 c7                	mov    %eax,%edi
+     8eb:	6a 54                	push   $0x54
+     8ed:	e8 1e 0a 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8f2:	83 c4 0c             	add    $0xc,%esp
+     8f5:	6a 54                	push   $0x54
+     8f7:	6a 00                	push   $0x0
+     8f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     8fc:	50                   	push   %eax
+     8fd:	e8 ae 04 00 00       	call   db0 <memset>
+  cmd->type = EXEC;
+     902:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     905:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     908:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     90e:	56                   	push   %esi
+     90f:	53                   	push   %ebx
+     910:	50                   	push   %eax
+     911:	e8 6a fe ff ff       	call   780 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     916:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     919:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     91c:	eb 15                	jmp    933 <parseexec+0x73>
+     91e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     920:	83 ec 04             	sub    $0x4,%esp
+     923:	56                   	push   %esi
+     924:	53                   	push   %ebx
+     925:	ff 75 d4             	push   -0x2c(%ebp)
+     928:	e8 53 fe ff ff       	call   780 <parseredirs>
+     92d:	83 c4 10             	add    $0x10,%esp
+     930:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     933:	83 ec 04             	sub    $0x4,%esp
+     936:	68 6b 20 00 00       	push   $0x206b
+     93b:	56                   	push   %esi
+     93c:	53                   	push   %ebx
+     93d:	e8 be fd ff ff       	call   700 <peek>
+     942:	83 c4 10             	add    $0x10,%esp
+     945:	85 c0                	test   %eax,%eax
+     947:	75 5f                	jne    9a8 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     949:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     94c:	50                   	push   %eax
+     94d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     950:	50                   	push   %eax
+     951:	56                   	push   %esi
+     952:	53                   	push   %ebx
+     953:	e8 38 fc ff ff       	call   590 <gettoken>
+     958:	83 c4 10             	add    $0x10,%esp
+     95b:	85 c0                	test   %eax,%eax
+     95d:	74 49                	je     9a8 <parseexec+0xe8>
+    if(tok != 'a')
+     95f:	83 f8 61             	cmp    $0x61,%eax
+     962:	75 62                	jne    9c6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     964:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     967:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     96a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     96e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     971:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     975:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     978:	83 ff 0a             	cmp    $0xa,%edi
+     97b:	75 a3                	jne    920 <parseexec+0x60>
+      panic("too many args");
+     97d:	83 ec 0c             	sub    $0xc,%esp
+     980:	68 5d 20 00 00       	push   $0x205d
+     985:	e8 56 f8 ff ff       	call   1e0 <panic>
+     98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     990:	89 75 0c             	mov    %esi,0xc(%ebp)
+     993:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     996:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     999:	5b                   	pop    %ebx
+     99a:	5e                   	pop    %esi
+     99b:	5f                   	pop    %edi
+     99c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     99d:	e9 ae 01 00 00       	jmp    b50 <parseblock>
+     9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     9a8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     9ab:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     9b2:	00 
+  cmd->eargv[argc] = 0;
+     9b3:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     9ba:	00 
+}
+     9bb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     9be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9c1:	5b                   	pop    %ebx
+     9c2:	5e                   	pop    %esi
+     9c3:	5f                   	pop    %edi
+     9c4:	5d                   	pop    %ebp
+     9c5:	c3                   	ret
+      panic("syntax");
+     9c6:	83 ec 0c             	sub    $0xc,%esp
+     9c9:	68 56 20 00 00       	push   $0x2056
+     9ce:	e8 0d f8 ff ff       	call   1e0 <panic>
+     9d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <parsepipe>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	57                   	push   %edi
+     9e4:	56                   	push   %esi
+     9e5:	53                   	push   %ebx
+     9e6:	83 ec 14             	sub    $0x14,%esp
+     9e9:	8b 75 08             	mov    0x8(%ebp),%esi
+     9ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     9ef:	57                   	push   %edi
+     9f0:	56                   	push   %esi
+     9f1:	e8 ca fe ff ff       	call   8c0 <parseexec>
+  if(peek(ps, es, "|")){
+     9f6:	83 c4 0c             	add    $0xc,%esp
+     9f9:	68 70 20 00 00       	push   $0x2070
+  cmd = parseexec(ps, es);
+     9fe:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     a00:	57                   	push   %edi
+     a01:	56                   	push   %esi
+     a02:	e8 f9 fc ff ff       	call   700 <peek>
+     a07:	83 c4 10             	add    $0x10,%esp
+     a0a:	85 c0                	test   %eax,%eax
+     a0c:	75 12                	jne    a20 <parsepipe+0x40>
+}
+     a0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a11:	89 d8                	mov    %ebx,%eax
+     a13:	5b                   	pop    %ebx
+     a14:	5e                   	pop    %esi
+     a15:	5f                   	pop    %edi
+     a16:	5d                   	pop    %ebp
+     a17:	c3                   	ret
+     a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     a20:	6a 00                	push   $0x0
+     a22:	6a 00                	push   $0x0
+     a24:	57                   	push   %edi
+     a25:	56                   	push   %esi
+     a26:	e8 65 fb ff ff       	call   590 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     a2b:	58                   	pop    %eax
+     a2c:	5a                   	pop    %edx
+     a2d:	57                   	push   %edi
+     a2e:	56                   	push   %esi
+     a2f:	e8 ac ff ff ff       	call   9e0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     a34:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     a3b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     a3d:	e8 ce 08 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a42:	83 c4 0c             	add    $0xc,%esp
+     a45:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a47:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a49:	6a 00                	push   $0x0
+     a4b:	50                   	push   %eax
+     a4c:	e8 5f 03 00 00       	call   db0 <memset>
+  cmd->left = left;
+     a51:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a54:	83 c4 10             	add    $0x10,%esp
+     a57:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     a59:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     a5f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a61:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a67:	5b                   	pop    %ebx
+     a68:	5e                   	pop    %esi
+     a69:	5f                   	pop    %edi
+     a6a:	5d                   	pop    %ebp
+     a6b:	c3                   	ret
+     a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a70 <parseline>:
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	57                   	push   %edi
+     a74:	56                   	push   %esi
+     a75:	53                   	push   %ebx
+     a76:	83 ec 24             	sub    $0x24,%esp
+     a79:	8b 75 08             	mov    0x8(%ebp),%esi
+     a7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     a7f:	57                   	push   %edi
+     a80:	56                   	push   %esi
+     a81:	e8 5a ff ff ff       	call   9e0 <parsepipe>
+  while(peek(ps, es, "&")){
+     a86:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     a89:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     a8b:	eb 3b                	jmp    ac8 <parseline+0x58>
+     a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     a90:	6a 00                	push   $0x0
+     a92:	6a 00                	push   $0x0
+     a94:	57                   	push   %edi
+     a95:	56                   	push   %esi
+     a96:	e8 f5 fa ff ff       	call   590 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     a9b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     aa2:	e8 69 08 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     aa7:	83 c4 0c             	add    $0xc,%esp
+     aaa:	6a 08                	push   $0x8
+     aac:	6a 00                	push   $0x0
+     aae:	50                   	push   %eax
+     aaf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ab2:	e8 f9 02 00 00       	call   db0 <memset>
+  cmd->type = BACK;
+     ab7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     aba:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     abd:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     ac3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     ac6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     ac8:	83 ec 04             	sub    $0x4,%esp
+     acb:	68 72 20 00 00       	push   $0x2072
+     ad0:	57                   	push   %edi
+     ad1:	56                   	push   %esi
+     ad2:	e8 29 fc ff ff       	call   700 <peek>
+     ad7:	83 c4 10             	add    $0x10,%esp
+     ada:	85 c0                	test   %eax,%eax
+     adc:	75 b2                	jne    a90 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     ade:	83 ec 04             	sub    $0x4,%esp
+     ae1:	68 6e 20 00 00       	push   $0x206e
+     ae6:	57                   	push   %edi
+     ae7:	56                   	push   %esi
+     ae8:	e8 13 fc ff ff       	call   700 <peek>
+     aed:	83 c4 10             	add    $0x10,%esp
+     af0:	85 c0                	test   %eax,%eax
+     af2:	75 0c                	jne    b00 <parseline+0x90>
+}
+     af4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     af7:	89 d8                	mov    %ebx,%eax
+     af9:	5b                   	pop    %ebx
+     afa:	5e                   	pop    %esi
+     afb:	5f                   	pop    %edi
+     afc:	5d                   	pop    %ebp
+     afd:	c3                   	ret
+     afe:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     b00:	6a 00                	push   $0x0
+     b02:	6a 00                	push   $0x0
+     b04:	57                   	push   %edi
+     b05:	56                   	push   %esi
+     b06:	e8 85 fa ff ff       	call   590 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     b0b:	58                   	pop    %eax
+     b0c:	5a                   	pop    %edx
+     b0d:	57                   	push   %edi
+     b0e:	56                   	push   %esi
+     b0f:	e8 5c ff ff ff       	call   a70 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     b14:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     b1b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     b1d:	e8 ee 07 00 00       	call   1310 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b22:	83 c4 0c             	add    $0xc,%esp
+     b25:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     b27:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     b29:	6a 00                	push   $0x0
+     b2b:	50                   	push   %eax
+     b2c:	e8 7f 02 00 00       	call   db0 <memset>
+  cmd->left = left;
+     b31:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     b34:	83 c4 10             	add    $0x10,%esp
+     b37:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     b39:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     b3f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     b41:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     b44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b47:	5b                   	pop    %ebx
+     b48:	5e                   	pop    %esi
+     b49:	5f                   	pop    %edi
+     b4a:	5d                   	pop    %ebp
+     b4b:	c3                   	ret
+     b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b50 <parseblock>:
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	56                   	push   %esi
+     b55:	53                   	push   %ebx
+     b56:	83 ec 10             	sub    $0x10,%esp
+     b59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b5c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     b5f:	68 54 20 00 00       	push   $0x2054
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	e8 95 fb ff ff       	call   700 <peek>
+     b6b:	83 c4 10             	add    $0x10,%esp
+     b6e:	85 c0                	test   %eax,%eax
+     b70:	74 4a                	je     bbc <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     b72:	6a 00                	push   $0x0
+     b74:	6a 00                	push   $0x0
+     b76:	56                   	push   %esi
+     b77:	53                   	push   %ebx
+     b78:	e8 13 fa ff ff       	call   590 <gettoken>
+  cmd = parseline(ps, es);
+     b7d:	58                   	pop    %eax
+     b7e:	5a                   	pop    %edx
+     b7f:	56                   	push   %esi
+     b80:	53                   	push   %ebx
+     b81:	e8 ea fe ff ff       	call   a70 <parseline>
+  if(!peek(ps, es, ")"))
+     b86:	83 c4 0c             	add    $0xc,%esp
+     b89:	68 90 20 00 00       	push   $0x2090
+  cmd = parseline(ps, es);
+     b8e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     b90:	56                   	push   %esi
+     b91:	53                   	push   %ebx
+     b92:	e8 69 fb ff ff       	call   700 <peek>
+     b97:	83 c4 10             	add    $0x10,%esp
+     b9a:	85 c0                	test   %eax,%eax
+     b9c:	74 2b                	je     bc9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     b9e:	6a 00                	push   $0x0
+     ba0:	6a 00                	push   $0x0
+     ba2:	56                   	push   %esi
+     ba3:	53                   	push   %ebx
+     ba4:	e8 e7 f9 ff ff       	call   590 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     ba9:	83 c4 0c             	add    $0xc,%esp
+     bac:	56                   	push   %esi
+     bad:	53                   	push   %ebx
+     bae:	57                   	push   %edi
+     baf:	e8 cc fb ff ff       	call   780 <parseredirs>
+}
+     bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bb7:	5b                   	pop    %ebx
+     bb8:	5e                   	pop    %esi
+     bb9:	5f                   	pop    %edi
+     bba:	5d                   	pop    %ebp
+     bbb:	c3                   	ret
+    panic("parseblock");
+     bbc:	83 ec 0c             	sub    $0xc,%esp
+     bbf:	68 74 20 00 00       	push   $0x2074
+     bc4:	e8 17 f6 ff ff       	call   1e0 <panic>
+    panic("syntax - missing )");
+     bc9:	83 ec 0c             	sub    $0xc,%esp
+     bcc:	68 7f 20 00 00       	push   $0x207f
+     bd1:	e8 0a f6 ff ff       	call   1e0 <panic>
+     bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000be0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	53                   	push   %ebx
+     be4:	83 ec 04             	sub    $0x4,%esp
+     be7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     bea:	85 db                	test   %ebx,%ebx
+     bec:	0f 84 7e 00 00 00    	je     c70 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     bf2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     bf5:	77 20                	ja     c17 <nulterminate+0x37>
+     bf7:	8b 03                	mov    (%ebx),%eax
+     bf9:	ff 24 85 d0 20 00 00 	jmp    *0x20d0(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	ff 73 04             	push   0x4(%ebx)
+     c06:	e8 d5 ff ff ff       	call   be0 <nulterminate>
+    nulterminate(lcmd->right);
+     c0b:	58                   	pop    %eax
+     c0c:	ff 73 08             	push   0x8(%ebx)
+     c0f:	e8 cc ff ff ff       	call   be0 <nulterminate>
+    break;
+     c14:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     c17:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c1c:	c9                   	leave
+     c1d:	c3                   	ret
+     c1e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     c20:	83 ec 0c             	sub    $0xc,%esp
+     c23:	ff 73 04             	push   0x4(%ebx)
+     c26:	e8 b5 ff ff ff       	call   be0 <nulterminate>
+    break;
+     c2b:	83 c4 10             	add    $0x10,%esp
+     c2e:	eb e7                	jmp    c17 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     c30:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     c33:	8d 43 08             	lea    0x8(%ebx),%eax
+     c36:	85 c9                	test   %ecx,%ecx
+     c38:	74 dd                	je     c17 <nulterminate+0x37>
+     c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     c40:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     c43:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     c46:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     c49:	8b 50 fc             	mov    -0x4(%eax),%edx
+     c4c:	85 d2                	test   %edx,%edx
+     c4e:	75 f0                	jne    c40 <nulterminate+0x60>
+     c50:	eb c5                	jmp    c17 <nulterminate+0x37>
+     c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     c58:	83 ec 0c             	sub    $0xc,%esp
+     c5b:	ff 73 04             	push   0x4(%ebx)
+     c5e:	e8 7d ff ff ff       	call   be0 <nulterminate>
+    *rcmd->efile = 0;
+     c63:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     c66:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     c69:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     c6c:	eb a9                	jmp    c17 <nulterminate+0x37>
+     c6e:	66 90                	xchg   %ax,%ax
+    return 0;
+     c70:	31 c0                	xor    %eax,%eax
+     c72:	eb a5                	jmp    c19 <nulterminate+0x39>
+     c74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+
+00000c80 <parsecmd>:
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     c85:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     c88:	53                   	push   %ebx
+     c89:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     c8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     c8f:	53                   	push   %ebx
+     c90:	e8 eb 00 00 00       	call   d80 <strlen>
+  cmd = parseline(&s, es);
+     c95:	59                   	pop    %ecx
+     c96:	5e                   	pop    %esi
+  es = s + strlen(s);
+     c97:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     c99:	53                   	push   %ebx
+     c9a:	57                   	push   %edi
+     c9b:	e8 d0 fd ff ff       	call   a70 <parseline>
+  peek(&s, es, "");
+     ca0:	83 c4 0c             	add    $0xc,%esp
+     ca3:	68 1e 20 00 00       	push   $0x201e
+  cmd = parseline(&s, es);
+     ca8:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     caa:	53                   	push   %ebx
+     cab:	57                   	push   %edi
+     cac:	e8 4f fa ff ff       	call   700 <peek>
+  if(s != es){
+     cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb4:	83 c4 10             	add    $0x10,%esp
+     cb7:	39 d8                	cmp    %ebx,%eax
+     cb9:	75 13                	jne    cce <parsecmd+0x4e>
+  nulterminate(cmd);
+     cbb:	83 ec 0c             	sub    $0xc,%esp
+     cbe:	56                   	push   %esi
+     cbf:	e8 1c ff ff ff       	call   be0 <nulterminate>
+}
+     cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc7:	89 f0                	mov    %esi,%eax
+     cc9:	5b                   	pop    %ebx
+     cca:	5e                   	pop    %esi
+     ccb:	5f                   	pop    %edi
+     ccc:	5d                   	pop    %ebp
+     ccd:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     cce:	52                   	push   %edx
+     ccf:	50                   	push   %eax
+     cd0:	68 92 20 00 00       	push   $0x2092
+     cd5:	6a 02                	push   $0x2
+     cd7:	e8 f4 03 00 00       	call   10d0 <printf>
+    panic("syntax");
+     cdc:	c7 04 24 56 20 00 00 	movl   $0x2056,(%esp)
+     ce3:	e8 f8 f4 ff ff       	call   1e0 <panic>
+     ce8:	66 90                	xchg   %ax,%ax
+     cea:	66 90                	xchg   %ax,%ax
+     cec:	66 90                	xchg   %ax,%ax
+     cee:	66 90                	xchg   %ax,%ax
+
+00000cf0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     cf0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     cf1:	31 c0                	xor    %eax,%eax
+{
+     cf3:	89 e5                	mov    %esp,%ebp
+     cf5:	53                   	push   %ebx
+     cf6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     cf9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     d00:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     d04:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     d07:	83 c0 01             	add    $0x1,%eax
+     d0a:	84 d2                	test   %dl,%dl
+     d0c:	75 f2                	jne    d00 <strcpy+0x10>
+    ;
+  return os;
+}
+     d0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d11:	89 c8                	mov    %ecx,%eax
+     d13:	c9                   	leave
+     d14:	c3                   	ret
+     d15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d20 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	53                   	push   %ebx
+     d24:	8b 55 08             	mov    0x8(%ebp),%edx
+     d27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     d2a:	0f b6 02             	movzbl (%edx),%eax
+     d2d:	84 c0                	test   %al,%al
+     d2f:	75 17                	jne    d48 <strcmp+0x28>
+     d31:	eb 3a                	jmp    d6d <strcmp+0x4d>
+     d33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d37:	90                   	nop
+     d38:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     d3c:	83 c2 01             	add    $0x1,%edx
+     d3f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     d42:	84 c0                	test   %al,%al
+     d44:	74 1a                	je     d60 <strcmp+0x40>
+    p++, q++;
+     d46:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     d48:	0f b6 19             	movzbl (%ecx),%ebx
+     d4b:	38 c3                	cmp    %al,%bl
+     d4d:	74 e9                	je     d38 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     d4f:	29 d8                	sub    %ebx,%eax
+}
+     d51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d54:	c9                   	leave
+     d55:	c3                   	ret
+     d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     d60:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     d64:	31 c0                	xor    %eax,%eax
+     d66:	29 d8                	sub    %ebx,%eax
+}
+     d68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d6b:	c9                   	leave
+     d6c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     d6d:	0f b6 19             	movzbl (%ecx),%ebx
+     d70:	31 c0                	xor    %eax,%eax
+     d72:	eb db                	jmp    d4f <strcmp+0x2f>
+     d74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+
+00000d80 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     d80:	55                   	push   %ebp
+     d81:	89 e5                	mov    %esp,%ebp
+     d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     d86:	80 3a 00             	cmpb   $0x0,(%edx)
+     d89:	74 15                	je     da0 <strlen+0x20>
+     d8b:	31 c0                	xor    %eax,%eax
+     d8d:	8d 76 00             	lea    0x0(%esi),%esi
+     d90:	83 c0 01             	add    $0x1,%eax
+     d93:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     d97:	89 c1                	mov    %eax,%ecx
+     d99:	75 f5                	jne    d90 <strlen+0x10>
+    ;
+  return n;
+}
+     d9b:	89 c8                	mov    %ecx,%eax
+     d9d:	5d                   	pop    %ebp
+     d9e:	c3                   	ret
+     d9f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     da0:	31 c9                	xor    %ecx,%ecx
+}
+     da2:	5d                   	pop    %ebp
+     da3:	89 c8                	mov    %ecx,%eax
+     da5:	c3                   	ret
+     da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000db0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	57                   	push   %edi
+     db4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     db7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     dba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     dbd:	89 d7                	mov    %edx,%edi
+     dbf:	fc                   	cld
+     dc0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     dc2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     dc5:	89 d0                	mov    %edx,%eax
+     dc7:	c9                   	leave
+     dc8:	c3                   	ret
+     dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000dd0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	8b 45 08             	mov    0x8(%ebp),%eax
+     dd6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     dda:	0f b6 10             	movzbl (%eax),%edx
+     ddd:	84 d2                	test   %dl,%dl
+     ddf:	75 12                	jne    df3 <strchr+0x23>
+     de1:	eb 1d                	jmp    e00 <strchr+0x30>
+     de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     de7:	90                   	nop
+     de8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     dec:	83 c0 01             	add    $0x1,%eax
+     def:	84 d2                	test   %dl,%dl
+     df1:	74 0d                	je     e00 <strchr+0x30>
+    if(*s == c)
+     df3:	38 d1                	cmp    %dl,%cl
+     df5:	75 f1                	jne    de8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     df7:	5d                   	pop    %ebp
+     df8:	c3                   	ret
+     df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     e00:	31 c0                	xor    %eax,%eax
+}
+     e02:	5d                   	pop    %ebp
+     e03:	c3                   	ret
+     e04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e0f:	90                   	nop
+
+00000e10 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	57                   	push   %edi
+     e14:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     e15:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     e18:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     e19:	31 db                	xor    %ebx,%ebx
+{
+     e1b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     e1e:	eb 27                	jmp    e47 <gets+0x37>
+    cc = read(0, &c, 1);
+     e20:	83 ec 04             	sub    $0x4,%esp
+     e23:	6a 01                	push   $0x1
+     e25:	56                   	push   %esi
+     e26:	6a 00                	push   $0x0
+     e28:	e8 1e 01 00 00       	call   f4b <read>
+    if(cc < 1)
+     e2d:	83 c4 10             	add    $0x10,%esp
+     e30:	85 c0                	test   %eax,%eax
+     e32:	7e 1d                	jle    e51 <gets+0x41>
+      break;
+    buf[i++] = c;
+     e34:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     e38:	8b 55 08             	mov    0x8(%ebp),%edx
+     e3b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     e3f:	3c 0a                	cmp    $0xa,%al
+     e41:	74 10                	je     e53 <gets+0x43>
+     e43:	3c 0d                	cmp    $0xd,%al
+     e45:	74 0c                	je     e53 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     e47:	89 df                	mov    %ebx,%edi
+     e49:	83 c3 01             	add    $0x1,%ebx
+     e4c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     e4f:	7c cf                	jl     e20 <gets+0x10>
+     e51:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     e53:	8b 45 08             	mov    0x8(%ebp),%eax
+     e56:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     e5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e5d:	5b                   	pop    %ebx
+     e5e:	5e                   	pop    %esi
+     e5f:	5f                   	pop    %edi
+     e60:	5d                   	pop    %ebp
+     e61:	c3                   	ret
+     e62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e70 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	56                   	push   %esi
+     e74:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     e75:	83 ec 08             	sub    $0x8,%esp
+     e78:	6a 00                	push   $0x0
+     e7a:	ff 75 08             	push   0x8(%ebp)
+     e7d:	e8 f1 00 00 00       	call   f73 <open>
+  if(fd < 0)
+     e82:	83 c4 10             	add    $0x10,%esp
+     e85:	85 c0                	test   %eax,%eax
+     e87:	78 27                	js     eb0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     e89:	83 ec 08             	sub    $0x8,%esp
+     e8c:	ff 75 0c             	push   0xc(%ebp)
+     e8f:	89 c3                	mov    %eax,%ebx
+     e91:	50                   	push   %eax
+     e92:	e8 f4 00 00 00       	call   f8b <fstat>
+  close(fd);
+     e97:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     e9a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     e9c:	e8 ba 00 00 00       	call   f5b <close>
+  return r;
+     ea1:	83 c4 10             	add    $0x10,%esp
+}
+     ea4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ea7:	89 f0                	mov    %esi,%eax
+     ea9:	5b                   	pop    %ebx
+     eaa:	5e                   	pop    %esi
+     eab:	5d                   	pop    %ebp
+     eac:	c3                   	ret
+     ead:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     eb0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     eb5:	eb ed                	jmp    ea4 <stat+0x34>
+     eb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebe:	66 90                	xchg   %ax,%ax
+
+00000ec0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	53                   	push   %ebx
+     ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     ec7:	0f be 02             	movsbl (%edx),%eax
+     eca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     ecd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     ed0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     ed5:	77 1e                	ja     ef5 <atoi+0x35>
+     ed7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ede:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     ee0:	83 c2 01             	add    $0x1,%edx
+     ee3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     ee6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     eea:	0f be 02             	movsbl (%edx),%eax
+     eed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     ef0:	80 fb 09             	cmp    $0x9,%bl
+     ef3:	76 eb                	jbe    ee0 <atoi+0x20>
+  return n;
+}
+     ef5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ef8:	89 c8                	mov    %ecx,%eax
+     efa:	c9                   	leave
+     efb:	c3                   	ret
+     efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f00 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	57                   	push   %edi
+     f04:	56                   	push   %esi
+     f05:	8b 45 10             	mov    0x10(%ebp),%eax
+     f08:	8b 55 08             	mov    0x8(%ebp),%edx
+     f0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     f0e:	85 c0                	test   %eax,%eax
+     f10:	7e 13                	jle    f25 <memmove+0x25>
+     f12:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     f14:	89 d7                	mov    %edx,%edi
+     f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     f20:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     f21:	39 f8                	cmp    %edi,%eax
+     f23:	75 fb                	jne    f20 <memmove+0x20>
+  return vdst;
+}
+     f25:	5e                   	pop    %esi
+     f26:	89 d0                	mov    %edx,%eax
+     f28:	5f                   	pop    %edi
+     f29:	5d                   	pop    %ebp
+     f2a:	c3                   	ret
+
+00000f2b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     f2b:	b8 01 00 00 00       	mov    $0x1,%eax
+     f30:	cd 40                	int    $0x40
+     f32:	c3                   	ret
+
+00000f33 <exit>:
+SYSCALL(exit)
+     f33:	b8 02 00 00 00       	mov    $0x2,%eax
+     f38:	cd 40                	int    $0x40
+     f3a:	c3                   	ret
+
+00000f3b <wait>:
+SYSCALL(wait)
+     f3b:	b8 03 00 00 00       	mov    $0x3,%eax
+     f40:	cd 40                	int    $0x40
+     f42:	c3                   	ret
+
+00000f43 <pipe>:
+SYSCALL(pipe)
+     f43:	b8 04 00 00 00       	mov    $0x4,%eax
+     f48:	cd 40                	int    $0x40
+     f4a:	c3                   	ret
+
+00000f4b <read>:
+SYSCALL(read)
+     f4b:	b8 05 00 00 00       	mov    $0x5,%eax
+     f50:	cd 40                	int    $0x40
+     f52:	c3                   	ret
+
+00000f53 <write>:
+SYSCALL(write)
+     f53:	b8 10 00 00 00       	mov    $0x10,%eax
+     f58:	cd 40                	int    $0x40
+     f5a:	c3                   	ret
+
+00000f5b <close>:
+SYSCALL(close)
+     f5b:	b8 15 00 00 00       	mov    $0x15,%eax
+     f60:	cd 40                	int    $0x40
+     f62:	c3                   	ret
+
+00000f63 <kill>:
+SYSCALL(kill)
+     f63:	b8 06 00 00 00       	mov    $0x6,%eax
+     f68:	cd 40                	int    $0x40
+     f6a:	c3                   	ret
+
+00000f6b <exec>:
+SYSCALL(exec)
+     f6b:	b8 07 00 00 00       	mov    $0x7,%eax
+     f70:	cd 40                	int    $0x40
+     f72:	c3                   	ret
+
+00000f73 <open>:
+SYSCALL(open)
+     f73:	b8 0f 00 00 00       	mov    $0xf,%eax
+     f78:	cd 40                	int    $0x40
+     f7a:	c3                   	ret
+
+00000f7b <mknod>:
+SYSCALL(mknod)
+     f7b:	b8 11 00 00 00       	mov    $0x11,%eax
+     f80:	cd 40                	int    $0x40
+     f82:	c3                   	ret
+
+00000f83 <unlink>:
+SYSCALL(unlink)
+     f83:	b8 12 00 00 00       	mov    $0x12,%eax
+     f88:	cd 40                	int    $0x40
+     f8a:	c3                   	ret
+
+00000f8b <fstat>:
+SYSCALL(fstat)
+     f8b:	b8 08 00 00 00       	mov    $0x8,%eax
+     f90:	cd 40                	int    $0x40
+     f92:	c3                   	ret
+
+00000f93 <link>:
+SYSCALL(link)
+     f93:	b8 13 00 00 00       	mov    $0x13,%eax
+     f98:	cd 40                	int    $0x40
+     f9a:	c3                   	ret
+
+00000f9b <mkdir>:
+SYSCALL(mkdir)
+     f9b:	b8 14 00 00 00       	mov    $0x14,%eax
+     fa0:	cd 40                	int    $0x40
+     fa2:	c3                   	ret
+
+00000fa3 <chdir>:
+SYSCALL(chdir)
+     fa3:	b8 09 00 00 00       	mov    $0x9,%eax
+     fa8:	cd 40                	int    $0x40
+     faa:	c3                   	ret
+
+00000fab <dup>:
+SYSCALL(dup)
+     fab:	b8 0a 00 00 00       	mov    $0xa,%eax
+     fb0:	cd 40                	int    $0x40
+     fb2:	c3                   	ret
+
+00000fb3 <getpid>:
+SYSCALL(getpid)
+     fb3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     fb8:	cd 40                	int    $0x40
+     fba:	c3                   	ret
+
+00000fbb <sbrk>:
+SYSCALL(sbrk)
+     fbb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     fc0:	cd 40                	int    $0x40
+     fc2:	c3                   	ret
+
+00000fc3 <sleep>:
+SYSCALL(sleep)
+     fc3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     fc8:	cd 40                	int    $0x40
+     fca:	c3                   	ret
+
+00000fcb <uptime>:
+SYSCALL(uptime)
+     fcb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     fd0:	cd 40                	int    $0x40
+     fd2:	c3                   	ret
+
+00000fd3 <wmap>:
+SYSCALL(wmap)
+     fd3:	b8 16 00 00 00       	mov    $0x16,%eax
+     fd8:	cd 40                	int    $0x40
+     fda:	c3                   	ret
+
+00000fdb <wunmap>:
+SYSCALL(wunmap)
+     fdb:	b8 17 00 00 00       	mov    $0x17,%eax
+     fe0:	cd 40                	int    $0x40
+     fe2:	c3                   	ret
+
+00000fe3 <va2pa>:
+SYSCALL(va2pa)
+     fe3:	b8 18 00 00 00       	mov    $0x18,%eax
+     fe8:	cd 40                	int    $0x40
+     fea:	c3                   	ret
+
+00000feb <getwmapinfo>:
+SYSCALL(getwmapinfo)
+     feb:	b8 19 00 00 00       	mov    $0x19,%eax
+     ff0:	cd 40                	int    $0x40
+     ff2:	c3                   	ret
+
+00000ff3 <getwssinfo>:
+SYSCALL(getwssinfo)
+     ff3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     ff8:	cd 40                	int    $0x40
+     ffa:	c3                   	ret
+
+00000ffb <setmergeable>:
+SYSCALL(setmergeable)
+     ffb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1000:	cd 40                	int    $0x40
+    1002:	c3                   	ret
+
+00001003 <getvmstat>:
+SYSCALL(getvmstat)
+    1003:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1008:	cd 40                	int    $0x40
+    100a:	c3                   	ret
+
+0000100b <getfaulthist>:
+SYSCALL(getfaulthist)
+    100b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1010:	cd 40                	int    $0x40
+    1012:	c3                   	ret
+
+00001013 <getprocinfo>:
+SYSCALL(getprocinfo)
+    1013:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1018:	cd 40                	int    $0x40
+    101a:	c3                   	ret
+
+0000101b <spawn>:
+SYSCALL(spawn)
+    101b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1020:	cd 40                	int    $0x40
+    1022:	c3                   	ret
+
+00001023 <fsync>:
+SYSCALL(fsync)
+    1023:	b8 20 00 00 00       	mov    $0x20,%eax
+    1028:	cd 40                	int    $0x40
+    102a:	c3                   	ret
+    102b:	66 90                	xchg   %ax,%ax
+    102d:	66 90                	xchg   %ax,%ax
+    102f:	90                   	nop
+
+00001030 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	57                   	push   %edi
+    1034:	56                   	push   %esi
+    1035:	53                   	push   %ebx
+    1036:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1038:	89 d1                	mov    %edx,%ecx
+{
+    103a:	83 ec 3c             	sub    $0x3c,%esp
+    103d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1040:	85 d2                	test   %edx,%edx
+    1042:	0f 89 80 00 00 00    	jns    10c8 <printint+0x98>
+    1048:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    104c:	74 7a                	je     10c8 <printint+0x98>
+    x = -xx;
+    104e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1050:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1055:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1058:	31 f6                	xor    %esi,%esi
+    105a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1060:	89 c8                	mov    %ecx,%eax
+    1062:	31 d2                	xor    %edx,%edx
+    1064:	89 f7                	mov    %esi,%edi
+    1066:	f7 f3                	div    %ebx
+    1068:	8d 76 01             	lea    0x1(%esi),%esi
+    106b:	0f b6 92 48 21 00 00 	movzbl 0x2148(%edx),%edx
+    1072:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1076:	89 ca                	mov    %ecx,%edx
+    1078:	89 c1                	mov    %eax,%ecx
+    107a:	39 da                	cmp    %ebx,%edx
+    107c:	73 e2                	jae    1060 <printint+0x30>
+  if(neg)
+    107e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1081:	85 c0                	test   %eax,%eax
+    1083:	74 07                	je     108c <printint+0x5c>
+    buf[i++] = '-';
+    1085:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    108a:	89 f7                	mov    %esi,%edi
+    108c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    108f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1092:	01 df                	add    %ebx,%edi
+    1094:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1098:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    109b:	83 ec 04             	sub    $0x4,%esp
+    109e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    10a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    10a4:	6a 01                	push   $0x1
+    10a6:	50                   	push   %eax
+    10a7:	56                   	push   %esi
+    10a8:	e8 a6 fe ff ff       	call   f53 <write>
+  while(--i >= 0)
+    10ad:	89 f8                	mov    %edi,%eax
+    10af:	83 c4 10             	add    $0x10,%esp
+    10b2:	83 ef 01             	sub    $0x1,%edi
+    10b5:	39 d8                	cmp    %ebx,%eax
+    10b7:	75 df                	jne    1098 <printint+0x68>
+}
+    10b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10bc:	5b                   	pop    %ebx
+    10bd:	5e                   	pop    %esi
+    10be:	5f                   	pop    %edi
+    10bf:	5d                   	pop    %ebp
+    10c0:	c3                   	ret
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    10c8:	31 c0                	xor    %eax,%eax
+    10ca:	eb 89                	jmp    1055 <printint+0x25>
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	57                   	push   %edi
+    10d4:	56                   	push   %esi
+    10d5:	53                   	push   %ebx
+    10d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    10d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    10dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    10df:	0f b6 1e             	movzbl (%esi),%ebx
+    10e2:	83 c6 01             	add    $0x1,%esi
+    10e5:	84 db                	test   %bl,%bl
+    10e7:	74 67                	je     1150 <printf+0x80>
+    10e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    10ec:	31 d2                	xor    %edx,%edx
+    10ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    10f1:	eb 34                	jmp    1127 <printf+0x57>
+    10f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10f7:	90                   	nop
+    10f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    10fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1100:	83 f8 25             	cmp    $0x25,%eax
+    1103:	74 18                	je     111d <printf+0x4d>
+  write(fd, &c, 1);
+    1105:	83 ec 04             	sub    $0x4,%esp
+    1108:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    110b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    110e:	6a 01                	push   $0x1
+    1110:	50                   	push   %eax
+    1111:	57                   	push   %edi
+    1112:	e8 3c fe ff ff       	call   f53 <write>
+    1117:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    111a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    111d:	0f b6 1e             	movzbl (%esi),%ebx
+    1120:	83 c6 01             	add    $0x1,%esi
+    1123:	84 db                	test   %bl,%bl
+    1125:	74 29                	je     1150 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1127:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    112a:	85 d2                	test   %edx,%edx
+    112c:	74 ca                	je     10f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    112e:	83 fa 25             	cmp    $0x25,%edx
+    1131:	75 ea                	jne    111d <printf+0x4d>
+      if(c == 'd'){
+    1133:	83 f8 25             	cmp    $0x25,%eax
+    1136:	0f 84 24 01 00 00    	je     1260 <printf+0x190>
+    113c:	83 e8 63             	sub    $0x63,%eax
+    113f:	83 f8 15             	cmp    $0x15,%eax
+    1142:	77 1c                	ja     1160 <printf+0x90>
+    1144:	ff 24 85 f0 20 00 00 	jmp    *0x20f0(,%eax,4)
+    114b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1153:	5b                   	pop    %ebx
+    1154:	5e                   	pop    %esi
+    1155:	5f                   	pop    %edi
+    1156:	5d                   	pop    %ebp
+    1157:	c3                   	ret
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+  write(fd, &c, 1);
+    1160:	83 ec 04             	sub    $0x4,%esp
+    1163:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1166:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    116a:	6a 01                	push   $0x1
+    116c:	52                   	push   %edx
+    116d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1170:	57                   	push   %edi
+    1171:	e8 dd fd ff ff       	call   f53 <write>
+    1176:	83 c4 0c             	add    $0xc,%esp
+    1179:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    117c:	6a 01                	push   $0x1
+    117e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1181:	52                   	push   %edx
+    1182:	57                   	push   %edi
+    1183:	e8 cb fd ff ff       	call   f53 <write>
+        putc(fd, c);
+    1188:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    118b:	31 d2                	xor    %edx,%edx
+    118d:	eb 8e                	jmp    111d <printf+0x4d>
+    118f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1190:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1193:	83 ec 0c             	sub    $0xc,%esp
+    1196:	b9 10 00 00 00       	mov    $0x10,%ecx
+    119b:	8b 13                	mov    (%ebx),%edx
+    119d:	6a 00                	push   $0x0
+    119f:	89 f8                	mov    %edi,%eax
+        ap++;
+    11a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    11a4:	e8 87 fe ff ff       	call   1030 <printint>
+        ap++;
+    11a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    11ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11af:	31 d2                	xor    %edx,%edx
+    11b1:	e9 67 ff ff ff       	jmp    111d <printf+0x4d>
+    11b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    11c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    11c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    11c5:	83 c0 04             	add    $0x4,%eax
+    11c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    11cb:	85 db                	test   %ebx,%ebx
+    11cd:	0f 84 9d 00 00 00    	je     1270 <printf+0x1a0>
+        while(*s != 0){
+    11d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    11d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    11d8:	84 c0                	test   %al,%al
+    11da:	0f 84 3d ff ff ff    	je     111d <printf+0x4d>
+    11e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    11e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    11e6:	89 de                	mov    %ebx,%esi
+    11e8:	89 d3                	mov    %edx,%ebx
+    11ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    11f0:	83 ec 04             	sub    $0x4,%esp
+    11f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    11f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    11f9:	6a 01                	push   $0x1
+    11fb:	53                   	push   %ebx
+    11fc:	57                   	push   %edi
+    11fd:	e8 51 fd ff ff       	call   f53 <write>
+        while(*s != 0){
+    1202:	0f b6 06             	movzbl (%esi),%eax
+    1205:	83 c4 10             	add    $0x10,%esp
+    1208:	84 c0                	test   %al,%al
+    120a:	75 e4                	jne    11f0 <printf+0x120>
+      state = 0;
+    120c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    120f:	31 d2                	xor    %edx,%edx
+    1211:	e9 07 ff ff ff       	jmp    111d <printf+0x4d>
+    1216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1220:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1223:	83 ec 0c             	sub    $0xc,%esp
+    1226:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    122b:	8b 13                	mov    (%ebx),%edx
+    122d:	6a 01                	push   $0x1
+    122f:	e9 6b ff ff ff       	jmp    119f <printf+0xcf>
+    1234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1238:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    123b:	83 ec 04             	sub    $0x4,%esp
+    123e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1241:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1243:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1246:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1249:	6a 01                	push   $0x1
+    124b:	52                   	push   %edx
+    124c:	57                   	push   %edi
+    124d:	e8 01 fd ff ff       	call   f53 <write>
+        ap++;
+    1252:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1255:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1258:	31 d2                	xor    %edx,%edx
+    125a:	e9 be fe ff ff       	jmp    111d <printf+0x4d>
+    125f:	90                   	nop
+  write(fd, &c, 1);
+    1260:	83 ec 04             	sub    $0x4,%esp
+    1263:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1266:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1269:	6a 01                	push   $0x1
+    126b:	e9 11 ff ff ff       	jmp    1181 <printf+0xb1>
+    1270:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1275:	bb e8 20 00 00       	mov    $0x20e8,%ebx
+    127a:	e9 61 ff ff ff       	jmp    11e0 <printf+0x110>
+    127f:	90                   	nop
+
+00001280 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1280:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1281:	a1 84 30 00 00       	mov    0x3084,%eax
+{
+    1286:	89 e5                	mov    %esp,%ebp
+    1288:	57                   	push   %edi
+    1289:	56                   	push   %esi
+    128a:	53                   	push   %ebx
+    128b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    128e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1298:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    129a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    129c:	39 ca                	cmp    %ecx,%edx
+    129e:	73 30                	jae    12d0 <free+0x50>
+    12a0:	39 c1                	cmp    %eax,%ecx
+    12a2:	72 04                	jb     12a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    12a4:	39 c2                	cmp    %eax,%edx
+    12a6:	72 f0                	jb     1298 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    12a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    12ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    12ae:	39 f8                	cmp    %edi,%eax
+    12b0:	74 2e                	je     12e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    12b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    12b5:	8b 42 04             	mov    0x4(%edx),%eax
+    12b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    12bb:	39 f1                	cmp    %esi,%ecx
+    12bd:	74 38                	je     12f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    12bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    12c1:	5b                   	pop    %ebx
+  freep = p;
+    12c2:	89 15 84 30 00 00    	mov    %edx,0x3084
+}
+    12c8:	5e                   	pop    %esi
+    12c9:	5f                   	pop    %edi
+    12ca:	5d                   	pop    %ebp
+    12cb:	c3                   	ret
+    12cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    12d0:	39 c1                	cmp    %eax,%ecx
+    12d2:	72 d0                	jb     12a4 <free+0x24>
+    12d4:	eb c2                	jmp    1298 <free+0x18>
+    12d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    12e0:	03 70 04             	add    0x4(%eax),%esi
+    12e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    12e6:	8b 02                	mov    (%edx),%eax
+    12e8:	8b 00                	mov    (%eax),%eax
+    12ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    12ed:	8b 42 04             	mov    0x4(%edx),%eax
+    12f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    12f3:	39 f1                	cmp    %esi,%ecx
+    12f5:	75 c8                	jne    12bf <free+0x3f>
+    p->s.size += bp->s.size;
+    12f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    12fa:	89 15 84 30 00 00    	mov    %edx,0x3084
+    p->s.size += bp->s.size;
+    1300:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1303:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1306:	89 0a                	mov    %ecx,(%edx)
+}
+    1308:	5b                   	pop    %ebx
+    1309:	5e                   	pop    %esi
+    130a:	5f                   	pop    %edi
+    130b:	5d                   	pop    %ebp
+    130c:	c3                   	ret
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001310 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	57                   	push   %edi
+    1314:	56                   	push   %esi
+    1315:	53                   	push   %ebx
+    1316:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1319:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    131c:	8b 15 84 30 00 00    	mov    0x3084,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1322:	8d 78 07             	lea    0x7(%eax),%edi
+    1325:	c1 ef 03             	shr    $0x3,%edi
+    1328:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    132b:	85 d2                	test   %edx,%edx
+    132d:	0f 84 8d 00 00 00    	je     13c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1333:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1335:	8b 48 04             	mov    0x4(%eax),%ecx
+    1338:	39 f9                	cmp    %edi,%ecx
+    133a:	73 64                	jae    13a0 <malloc+0x90>
+  if(nu < 4096)
+    133c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1341:	39 df                	cmp    %ebx,%edi
+    1343:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1346:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    134d:	eb 0a                	jmp    1359 <malloc+0x49>
+    134f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1350:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1352:	8b 48 04             	mov    0x4(%eax),%ecx
+    1355:	39 f9                	cmp    %edi,%ecx
+    1357:	73 47                	jae    13a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1359:	89 c2                	mov    %eax,%edx
+    135b:	39 05 84 30 00 00    	cmp    %eax,0x3084
+    1361:	75 ed                	jne    1350 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1363:	83 ec 0c             	sub    $0xc,%esp
+    1366:	56                   	push   %esi
+    1367:	e8 4f fc ff ff       	call   fbb <sbrk>
+  if(p == (char*)-1)
+    136c:	83 c4 10             	add    $0x10,%esp
+    136f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1372:	74 1c                	je     1390 <malloc+0x80>
+  hp->s.size = nu;
+    1374:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1377:	83 ec 0c             	sub    $0xc,%esp
+    137a:	83 c0 08             	add    $0x8,%eax
+    137d:	50                   	push   %eax
+    137e:	e8 fd fe ff ff       	call   1280 <free>
+  return freep;
+    1383:	8b 15 84 30 00 00    	mov    0x3084,%edx
+      if((p = morecore(nunits)) == 0)
+    1389:	83 c4 10             	add    $0x10,%esp
+    138c:	85 d2                	test   %edx,%edx
+    138e:	75 c0                	jne    1350 <malloc+0x40>
+        return 0;
+  }
+}
+    1390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1393:	31 c0                	xor    %eax,%eax
+}
+    1395:	5b                   	pop    %ebx
+    1396:	5e                   	pop    %esi
+    1397:	5f                   	pop    %edi
+    1398:	5d                   	pop    %ebp
+    1399:	c3                   	ret
+    139a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    13a0:	39 cf                	cmp    %ecx,%edi
+    13a2:	74 4c                	je     13f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    13a4:	29 f9                	sub    %edi,%ecx
+    13a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    13a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    13ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    13af:	89 15 84 30 00 00    	mov    %edx,0x3084
+}
+    13b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    13b8:	83 c0 08             	add    $0x8,%eax
+}
+    13bb:	5b                   	pop    %ebx
+    13bc:	5e                   	pop    %esi
+    13bd:	5f                   	pop    %edi
+    13be:	5d                   	pop    %ebp
+    13bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    13c0:	c7 05 84 30 00 00 88 	movl   $0x3088,0x3084
+    13c7:	30 00 00 
+    base.s.size = 0;
+    13ca:	b8 88 30 00 00       	mov    $0x3088,%eax
+    base.s.ptr = freep = prevp = &base;
+    13cf:	c7 05 88 30 00 00 88 	movl   $0x3088,0x3088
+    13d6:	30 00 00 
+    base.s.size = 0;
+    13d9:	c7 05 8c 30 00 00 00 	movl   $0x0,0x308c
+    13e0:	00 00 00 
+    if(p->s.size >= nunits){
+    13e3:	e9 54 ff ff ff       	jmp    133c <malloc+0x2c>
+    13e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    13f0:	8b 08                	mov    (%eax),%ecx
+    13f2:	89 0a                	mov    %ecx,(%edx)
+    13f4:	eb b9                	jmp    13af <malloc+0x9f>
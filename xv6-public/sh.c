@@ -52,6 +52,7 @@ struct backcmd {
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+int plaincmd(char*);
 
 // Execute cmd.  Never returns.
 void
@@ -146,6 +147,8 @@ main(void)
 {
   static char buf[100];
   int fd;
+  struct cmd *cmd;
+  struct execcmd *ecmd;
 
   // Ensure that three file descriptors are open.
   while((fd = open("console", O_RDWR)) >= 0){
@@ -164,6 +167,18 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
+    if(plaincmd(buf)){
+      // No need to copy the shell just to exec: build the
+      // child straight from the program file.
+      cmd = parsecmd(buf);
+      ecmd = (struct execcmd*)cmd;
+      if(spawn(ecmd->argv[0], ecmd->argv, 0, 0) < 0)
+        printf(2, "exec %s failed\n", ecmd->argv[0]);
+      else
+        wait();
+      free(cmd);
+      continue;
+    }
     if(fork1() == 0)
       runcmd(parsecmd(buf));
     wait();
@@ -262,6 +277,25 @@ backcmd(struct cmd *subcmd)
 char whitespace[] = " \t\r\n\v";
 char symbols[] = "<|>&;()";
 
+// Is buf a lone command with no redirections, pipes, lists or
+// background jobs, and few enough words that parsecmd() cannot
+// fail on it?
+int
+plaincmd(char *buf)
+{
+  char *s;
+  int n;
+
+  n = 0;
+  for(s = buf; *s; s++){
+    if(strchr(symbols, *s))
+      return 0;
+    if(!strchr(whitespace, *s) && (s == buf || strchr(whitespace, s[-1])))
+      n++;
+  }
+  return n > 0 && n < MAXARGS;
+}
+
 int
 gettoken(char **ps, char *es, char **q, char **eq)
 {
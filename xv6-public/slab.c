@@ -0,0 +1,235 @@
+// Slab allocator for small kernel objects.
+//
+// A kmem_cache hands out fixed-size objects carved from slabs:
+// naturally aligned blocks of 2^order pages from kalloc_pages()
+// that begin with a struct slab header. An object's slab is found
+// by rounding its address down to the slab size.
+//
+// In front of the slabs each CPU has a magazine, a small stack of
+// free objects that kmem_cache_alloc() and kmem_cache_free() use
+// without taking the cache lock. An empty magazine is refilled, and
+// a full one flushed, MAGBATCH objects at a time.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define NCACHE   16  // maximum number of caches
+#define MAGSIZE  16  // objects per per-CPU magazine
+#define MAGBATCH  8  // objects moved between magazine and slabs at once
+#define MINOBJS   8  // grow the slab order until this many objects fit
+
+struct slab {
+  struct slab *next;         // cache's partial list
+  struct slab *prev;
+  struct kmem_cache *cache;
+  void *freelist;            // free objects, linked through their first word
+  int inuse;                 // objects handed out from this slab
+};
+
+#define SLABHDR ((sizeof(struct slab) + 7) & ~7)
+
+struct magazine {
+  int n;
+  void *obj[MAGSIZE];
+};
+
+struct kmem_cache {
+  struct spinlock lock;
+  char *name;
+  uint size;              // object size, rounded up to 8 bytes
+  int order;              // slabs are 2^order pages
+  int perslab;            // objects per slab
+  struct slab *partial;   // slabs with some but not all objects free
+  struct slab *empty;     // one completely free slab kept for reuse
+  uint nslab;             // slabs currently allocated
+  uint ninuse;            // objects outside the slabs (incl. magazines)
+  struct magazine mag[NCPU];
+};
+
+struct {
+  struct spinlock lock;
+  int n;
+  struct kmem_cache cache[NCACHE];
+} slabtable;
+
+// Create a cache of objects of the given size. Caches are
+// never destroyed.
+struct kmem_cache*
+kmem_cache_create(char *name, uint size)
+{
+  struct kmem_cache *c;
+
+  if(slabtable.n == 0)
+    initlock(&slabtable.lock, "slabtable");
+  acquire(&slabtable.lock);
+  if(slabtable.n == NCACHE)
+    panic("kmem_cache_create: too many caches");
+  c = &slabtable.cache[slabtable.n++];
+  release(&slabtable.lock);
+
+  memset(c, 0, sizeof(*c));
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = (size + 7) & ~7;
+  if(c->size < sizeof(void*))
+    c->size = sizeof(void*);
+  while(c->order < MAXORDER &&
+        ((PGSIZE << c->order) - SLABHDR) / c->size < MINOBJS)
+    c->order++;
+  c->perslab = ((PGSIZE << c->order) - SLABHDR) / c->size;
+  if(c->perslab == 0)
+    panic("kmem_cache_create: object too big");
+  return c;
+}
+
+static void
+slabinsert(struct slab **list, struct slab *s)
+{
+  s->prev = 0;
+  s->next = *list;
+  if(s->next)
+    s->next->prev = s;
+  *list = s;
+}
+
+static void
+slabremove(struct slab **list, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    *list = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+// Allocate and carve up a new slab. Caller holds c->lock.
+static struct slab*
+newslab(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *obj;
+  int i;
+
+  if((s = (struct slab*)kalloc_pages(c->order)) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  s->freelist = 0;
+  obj = (char*)s + SLABHDR + (c->perslab - 1)*c->size;
+  for(i = 0; i < c->perslab; i++, obj -= c->size){
+    *(void**)obj = s->freelist;
+    s->freelist = obj;
+  }
+  c->nslab++;
+  return s;
+}
+
+// Take one object out of the slabs. Caller holds c->lock.
+static void*
+slaballoc(struct kmem_cache *c)
+{
+  struct slab *s;
+  void *obj;
+
+  if((s = c->partial) == 0){
+    if((s = c->empty) != 0)
+      c->empty = 0;
+    else if((s = newslab(c)) == 0)
+      return 0;
+    slabinsert(&c->partial, s);
+  }
+  obj = s->freelist;
+  s->freelist = *(void**)obj;
+  if(++s->inuse == c->perslab)
+    slabremove(&c->partial, s);
+  c->ninuse++;
+  return obj;
+}
+
+// Put one object back into its slab. Caller holds c->lock.
+static void
+slabfree(struct kmem_cache *c, void *obj)
+{
+  struct slab *s;
+
+  s = (struct slab*)((uint)obj & ~((PGSIZE << c->order) - 1));
+  if(s->cache != c || s->inuse <= 0)
+    panic("kmem_cache_free");
+  *(void**)obj = s->freelist;
+  s->freelist = obj;
+  if(s->inuse-- == c->perslab)
+    slabinsert(&c->partial, s);
+  c->ninuse--;
+  if(s->inuse > 0)
+    return;
+  slabremove(&c->partial, s);
+  if(c->empty == 0){
+    c->empty = s;
+  } else {
+    c->nslab--;
+    kfree_pages((char*)s, c->order);
+  }
+}
+
+// Allocate one object from c. Returns 0 if out of memory.
+void*
+kmem_cache_alloc(struct kmem_cache *c)
+{
+  struct magazine *m;
+  void *obj;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == 0){
+    acquire(&c->lock);
+    while(m->n < MAGBATCH && (obj = slaballoc(c)) != 0)
+      m->obj[m->n++] = obj;
+    release(&c->lock);
+  }
+  obj = 0;
+  if(m->n > 0)
+    obj = m->obj[--m->n];
+  popcli();
+  return obj;
+}
+
+// Return obj, which came from kmem_cache_alloc(c).
+void
+kmem_cache_free(struct kmem_cache *c, void *obj)
+{
+  struct magazine *m;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == MAGSIZE){
+    acquire(&c->lock);
+    while(m->n > MAGSIZE - MAGBATCH)
+      slabfree(c, m->obj[--m->n]);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = obj;
+  popcli();
+}
+
+// Print per-cache usage. Runs on ^P; no lock to avoid
+// wedging a stuck machine further.
+void
+slabdump(void)
+{
+  struct kmem_cache *c;
+  int i, cached;
+
+  for(c = slabtable.cache; c < &slabtable.cache[slabtable.n]; c++){
+    cached = 0;
+    for(i = 0; i < NCPU; i++)
+      cached += c->mag[i].n;
+    cprintf("slab %s: size %d, %d slabs of %d pages, %d in use, %d cached\n",
+            c->name, c->size, c->nslab, 1 << c->order,
+            c->ninuse - cached, cached);
+  }
+}
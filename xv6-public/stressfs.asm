@@ -0,0 +1,1274 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 00 10 00 00       	push   $0x1000
+  44:	6a 01                	push   $0x1
+  46:	e8 b5 04 00 00       	call   500 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 f8 02 00 00       	call   35b <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 13 10 00 00       	push   $0x1013
+  78:	6a 01                	push   $0x1
+  7a:	e8 81 04 00 00       	call   500 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 06 03 00 00       	call   3a3 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 cc 02 00 00       	call   383 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 c3 02 00 00       	call   38b <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 1d 10 00 00       	push   $0x101d
+  cf:	6a 01                	push   $0x1
+  d1:	e8 2a 04 00 00       	call   500 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 b8 02 00 00       	call   3a3 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 7c 02 00 00       	call   37b <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 7b 02 00 00       	call   38b <close>
+
+  wait();
+ 110:	e8 56 02 00 00       	call   36b <wait>
+
+  exit();
+ 115:	e8 49 02 00 00       	call   363 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 1e 01 00 00       	call   37b <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 f1 00 00 00       	call   3a3 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 f4 00 00 00       	call   3bb <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 ba 00 00 00       	call   38b <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+
+0000035b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <exit>:
+SYSCALL(exit)
+ 363:	b8 02 00 00 00       	mov    $0x2,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wait>:
+SYSCALL(wait)
+ 36b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pipe>:
+SYSCALL(pipe)
+ 373:	b8 04 00 00 00       	mov    $0x4,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <read>:
+SYSCALL(read)
+ 37b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <write>:
+SYSCALL(write)
+ 383:	b8 10 00 00 00       	mov    $0x10,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <close>:
+SYSCALL(close)
+ 38b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <kill>:
+SYSCALL(kill)
+ 393:	b8 06 00 00 00       	mov    $0x6,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <exec>:
+SYSCALL(exec)
+ 39b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <open>:
+SYSCALL(open)
+ 3a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mknod>:
+SYSCALL(mknod)
+ 3ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <unlink>:
+SYSCALL(unlink)
+ 3b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <fstat>:
+SYSCALL(fstat)
+ 3bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <link>:
+SYSCALL(link)
+ 3c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mkdir>:
+SYSCALL(mkdir)
+ 3cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <chdir>:
+SYSCALL(chdir)
+ 3d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <dup>:
+SYSCALL(dup)
+ 3db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getpid>:
+SYSCALL(getpid)
+ 3e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <sbrk>:
+SYSCALL(sbrk)
+ 3eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <sleep>:
+SYSCALL(sleep)
+ 3f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <uptime>:
+SYSCALL(uptime)
+ 3fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <wmap>:
+SYSCALL(wmap)
+ 403:	b8 16 00 00 00       	mov    $0x16,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <wunmap>:
+SYSCALL(wunmap)
+ 40b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <va2pa>:
+SYSCALL(va2pa)
+ 413:	b8 18 00 00 00       	mov    $0x18,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 41b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getwssinfo>:
+SYSCALL(getwssinfo)
+ 423:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <setmergeable>:
+SYSCALL(setmergeable)
+ 42b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <getvmstat>:
+SYSCALL(getvmstat)
+ 433:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <getfaulthist>:
+SYSCALL(getfaulthist)
+ 43b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getprocinfo>:
+SYSCALL(getprocinfo)
+ 443:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <spawn>:
+SYSCALL(spawn)
+ 44b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <fsync>:
+SYSCALL(fsync)
+ 453:	b8 20 00 00 00       	mov    $0x20,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+ 45b:	66 90                	xchg   %ax,%ax
+ 45d:	66 90                	xchg   %ax,%ax
+ 45f:	90                   	nop
+
+00000460 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 468:	89 d1                	mov    %edx,%ecx
+{
+ 46a:	83 ec 3c             	sub    $0x3c,%esp
+ 46d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 470:	85 d2                	test   %edx,%edx
+ 472:	0f 89 80 00 00 00    	jns    4f8 <printint+0x98>
+ 478:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 47c:	74 7a                	je     4f8 <printint+0x98>
+    x = -xx;
+ 47e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 480:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 485:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 488:	31 f6                	xor    %esi,%esi
+ 48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 490:	89 c8                	mov    %ecx,%eax
+ 492:	31 d2                	xor    %edx,%edx
+ 494:	89 f7                	mov    %esi,%edi
+ 496:	f7 f3                	div    %ebx
+ 498:	8d 76 01             	lea    0x1(%esi),%esi
+ 49b:	0f b6 92 84 10 00 00 	movzbl 0x1084(%edx),%edx
+ 4a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4a6:	89 ca                	mov    %ecx,%edx
+ 4a8:	89 c1                	mov    %eax,%ecx
+ 4aa:	39 da                	cmp    %ebx,%edx
+ 4ac:	73 e2                	jae    490 <printint+0x30>
+  if(neg)
+ 4ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4b1:	85 c0                	test   %eax,%eax
+ 4b3:	74 07                	je     4bc <printint+0x5c>
+    buf[i++] = '-';
+ 4b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ba:	89 f7                	mov    %esi,%edi
+ 4bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4c2:	01 df                	add    %ebx,%edi
+ 4c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4cb:	83 ec 04             	sub    $0x4,%esp
+ 4ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4d4:	6a 01                	push   $0x1
+ 4d6:	50                   	push   %eax
+ 4d7:	56                   	push   %esi
+ 4d8:	e8 a6 fe ff ff       	call   383 <write>
+  while(--i >= 0)
+ 4dd:	89 f8                	mov    %edi,%eax
+ 4df:	83 c4 10             	add    $0x10,%esp
+ 4e2:	83 ef 01             	sub    $0x1,%edi
+ 4e5:	39 d8                	cmp    %ebx,%eax
+ 4e7:	75 df                	jne    4c8 <printint+0x68>
+}
+ 4e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ec:	5b                   	pop    %ebx
+ 4ed:	5e                   	pop    %esi
+ 4ee:	5f                   	pop    %edi
+ 4ef:	5d                   	pop    %ebp
+ 4f0:	c3                   	ret
+ 4f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4f8:	31 c0                	xor    %eax,%eax
+ 4fa:	eb 89                	jmp    485 <printint+0x25>
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	53                   	push   %ebx
+ 506:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 509:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 50c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 50f:	0f b6 1e             	movzbl (%esi),%ebx
+ 512:	83 c6 01             	add    $0x1,%esi
+ 515:	84 db                	test   %bl,%bl
+ 517:	74 67                	je     580 <printf+0x80>
+ 519:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 51c:	31 d2                	xor    %edx,%edx
+ 51e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 521:	eb 34                	jmp    557 <printf+0x57>
+ 523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 527:	90                   	nop
+ 528:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 52b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 530:	83 f8 25             	cmp    $0x25,%eax
+ 533:	74 18                	je     54d <printf+0x4d>
+  write(fd, &c, 1);
+ 535:	83 ec 04             	sub    $0x4,%esp
+ 538:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 53b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 53e:	6a 01                	push   $0x1
+ 540:	50                   	push   %eax
+ 541:	57                   	push   %edi
+ 542:	e8 3c fe ff ff       	call   383 <write>
+ 547:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 54a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 54d:	0f b6 1e             	movzbl (%esi),%ebx
+ 550:	83 c6 01             	add    $0x1,%esi
+ 553:	84 db                	test   %bl,%bl
+ 555:	74 29                	je     580 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 557:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 55a:	85 d2                	test   %edx,%edx
+ 55c:	74 ca                	je     528 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 55e:	83 fa 25             	cmp    $0x25,%edx
+ 561:	75 ea                	jne    54d <printf+0x4d>
+      if(c == 'd'){
+ 563:	83 f8 25             	cmp    $0x25,%eax
+ 566:	0f 84 24 01 00 00    	je     690 <printf+0x190>
+ 56c:	83 e8 63             	sub    $0x63,%eax
+ 56f:	83 f8 15             	cmp    $0x15,%eax
+ 572:	77 1c                	ja     590 <printf+0x90>
+ 574:	ff 24 85 2c 10 00 00 	jmp    *0x102c(,%eax,4)
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 583:	5b                   	pop    %ebx
+ 584:	5e                   	pop    %esi
+ 585:	5f                   	pop    %edi
+ 586:	5d                   	pop    %ebp
+ 587:	c3                   	ret
+ 588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+  write(fd, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 596:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 59a:	6a 01                	push   $0x1
+ 59c:	52                   	push   %edx
+ 59d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5a0:	57                   	push   %edi
+ 5a1:	e8 dd fd ff ff       	call   383 <write>
+ 5a6:	83 c4 0c             	add    $0xc,%esp
+ 5a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ac:	6a 01                	push   $0x1
+ 5ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5b1:	52                   	push   %edx
+ 5b2:	57                   	push   %edi
+ 5b3:	e8 cb fd ff ff       	call   383 <write>
+        putc(fd, c);
+ 5b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5bb:	31 d2                	xor    %edx,%edx
+ 5bd:	eb 8e                	jmp    54d <printf+0x4d>
+ 5bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5cb:	8b 13                	mov    (%ebx),%edx
+ 5cd:	6a 00                	push   $0x0
+ 5cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5d4:	e8 87 fe ff ff       	call   460 <printint>
+        ap++;
+ 5d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5df:	31 d2                	xor    %edx,%edx
+ 5e1:	e9 67 ff ff ff       	jmp    54d <printf+0x4d>
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5f5:	83 c0 04             	add    $0x4,%eax
+ 5f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5fb:	85 db                	test   %ebx,%ebx
+ 5fd:	0f 84 9d 00 00 00    	je     6a0 <printf+0x1a0>
+        while(*s != 0){
+ 603:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 606:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 608:	84 c0                	test   %al,%al
+ 60a:	0f 84 3d ff ff ff    	je     54d <printf+0x4d>
+ 610:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 613:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 616:	89 de                	mov    %ebx,%esi
+ 618:	89 d3                	mov    %edx,%ebx
+ 61a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 626:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 629:	6a 01                	push   $0x1
+ 62b:	53                   	push   %ebx
+ 62c:	57                   	push   %edi
+ 62d:	e8 51 fd ff ff       	call   383 <write>
+        while(*s != 0){
+ 632:	0f b6 06             	movzbl (%esi),%eax
+ 635:	83 c4 10             	add    $0x10,%esp
+ 638:	84 c0                	test   %al,%al
+ 63a:	75 e4                	jne    620 <printf+0x120>
+      state = 0;
+ 63c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 63f:	31 d2                	xor    %edx,%edx
+ 641:	e9 07 ff ff ff       	jmp    54d <printf+0x4d>
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 650:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 65b:	8b 13                	mov    (%ebx),%edx
+ 65d:	6a 01                	push   $0x1
+ 65f:	e9 6b ff ff ff       	jmp    5cf <printf+0xcf>
+ 664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 668:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 66b:	83 ec 04             	sub    $0x4,%esp
+ 66e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 671:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 673:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 676:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 679:	6a 01                	push   $0x1
+ 67b:	52                   	push   %edx
+ 67c:	57                   	push   %edi
+ 67d:	e8 01 fd ff ff       	call   383 <write>
+        ap++;
+ 682:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 685:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 688:	31 d2                	xor    %edx,%edx
+ 68a:	e9 be fe ff ff       	jmp    54d <printf+0x4d>
+ 68f:	90                   	nop
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 696:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 699:	6a 01                	push   $0x1
+ 69b:	e9 11 ff ff ff       	jmp    5b1 <printf+0xb1>
+ 6a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6a5:	bb 23 10 00 00       	mov    $0x1023,%ebx
+ 6aa:	e9 61 ff ff ff       	jmp    610 <printf+0x110>
+ 6af:	90                   	nop
+
+000006b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b1:	a1 00 20 00 00       	mov    0x2000,%eax
+{
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	57                   	push   %edi
+ 6b9:	56                   	push   %esi
+ 6ba:	53                   	push   %ebx
+ 6bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6cc:	39 ca                	cmp    %ecx,%edx
+ 6ce:	73 30                	jae    700 <free+0x50>
+ 6d0:	39 c1                	cmp    %eax,%ecx
+ 6d2:	72 04                	jb     6d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d4:	39 c2                	cmp    %eax,%edx
+ 6d6:	72 f0                	jb     6c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6de:	39 f8                	cmp    %edi,%eax
+ 6e0:	74 2e                	je     710 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6eb:	39 f1                	cmp    %esi,%ecx
+ 6ed:	74 38                	je     727 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6f1:	5b                   	pop    %ebx
+  freep = p;
+ 6f2:	89 15 00 20 00 00    	mov    %edx,0x2000
+}
+ 6f8:	5e                   	pop    %esi
+ 6f9:	5f                   	pop    %edi
+ 6fa:	5d                   	pop    %ebp
+ 6fb:	c3                   	ret
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 700:	39 c1                	cmp    %eax,%ecx
+ 702:	72 d0                	jb     6d4 <free+0x24>
+ 704:	eb c2                	jmp    6c8 <free+0x18>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 710:	03 70 04             	add    0x4(%eax),%esi
+ 713:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 716:	8b 02                	mov    (%edx),%eax
+ 718:	8b 00                	mov    (%eax),%eax
+ 71a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 71d:	8b 42 04             	mov    0x4(%edx),%eax
+ 720:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 723:	39 f1                	cmp    %esi,%ecx
+ 725:	75 c8                	jne    6ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 727:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 72a:	89 15 00 20 00 00    	mov    %edx,0x2000
+    p->s.size += bp->s.size;
+ 730:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 733:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 736:	89 0a                	mov    %ecx,(%edx)
+}
+ 738:	5b                   	pop    %ebx
+ 739:	5e                   	pop    %esi
+ 73a:	5f                   	pop    %edi
+ 73b:	5d                   	pop    %ebp
+ 73c:	c3                   	ret
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000740 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 749:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 74c:	8b 15 00 20 00 00    	mov    0x2000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 752:	8d 78 07             	lea    0x7(%eax),%edi
+ 755:	c1 ef 03             	shr    $0x3,%edi
+ 758:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 75b:	85 d2                	test   %edx,%edx
+ 75d:	0f 84 8d 00 00 00    	je     7f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 763:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 765:	8b 48 04             	mov    0x4(%eax),%ecx
+ 768:	39 f9                	cmp    %edi,%ecx
+ 76a:	73 64                	jae    7d0 <malloc+0x90>
+  if(nu < 4096)
+ 76c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 771:	39 df                	cmp    %ebx,%edi
+ 773:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 776:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 77d:	eb 0a                	jmp    789 <malloc+0x49>
+ 77f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 780:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 782:	8b 48 04             	mov    0x4(%eax),%ecx
+ 785:	39 f9                	cmp    %edi,%ecx
+ 787:	73 47                	jae    7d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 789:	89 c2                	mov    %eax,%edx
+ 78b:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ 791:	75 ed                	jne    780 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	56                   	push   %esi
+ 797:	e8 4f fc ff ff       	call   3eb <sbrk>
+  if(p == (char*)-1)
+ 79c:	83 c4 10             	add    $0x10,%esp
+ 79f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7a2:	74 1c                	je     7c0 <malloc+0x80>
+  hp->s.size = nu;
+ 7a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7a7:	83 ec 0c             	sub    $0xc,%esp
+ 7aa:	83 c0 08             	add    $0x8,%eax
+ 7ad:	50                   	push   %eax
+ 7ae:	e8 fd fe ff ff       	call   6b0 <free>
+  return freep;
+ 7b3:	8b 15 00 20 00 00    	mov    0x2000,%edx
+      if((p = morecore(nunits)) == 0)
+ 7b9:	83 c4 10             	add    $0x10,%esp
+ 7bc:	85 d2                	test   %edx,%edx
+ 7be:	75 c0                	jne    780 <malloc+0x40>
+        return 0;
+  }
+}
+ 7c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7c3:	31 c0                	xor    %eax,%eax
+}
+ 7c5:	5b                   	pop    %ebx
+ 7c6:	5e                   	pop    %esi
+ 7c7:	5f                   	pop    %edi
+ 7c8:	5d                   	pop    %ebp
+ 7c9:	c3                   	ret
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7d0:	39 cf                	cmp    %ecx,%edi
+ 7d2:	74 4c                	je     820 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7d4:	29 f9                	sub    %edi,%ecx
+ 7d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7df:	89 15 00 20 00 00    	mov    %edx,0x2000
+}
+ 7e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7e8:	83 c0 08             	add    $0x8,%eax
+}
+ 7eb:	5b                   	pop    %ebx
+ 7ec:	5e                   	pop    %esi
+ 7ed:	5f                   	pop    %edi
+ 7ee:	5d                   	pop    %ebp
+ 7ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7f0:	c7 05 00 20 00 00 04 	movl   $0x2004,0x2000
+ 7f7:	20 00 00 
+    base.s.size = 0;
+ 7fa:	b8 04 20 00 00       	mov    $0x2004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7ff:	c7 05 04 20 00 00 04 	movl   $0x2004,0x2004
+ 806:	20 00 00 
+    base.s.size = 0;
+ 809:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 810:	00 00 00 
+    if(p->s.size >= nunits){
+ 813:	e9 54 ff ff ff       	jmp    76c <malloc+0x2c>
+ 818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 820:	8b 08                	mov    (%eax),%ecx
+ 822:	89 0a                	mov    %ecx,(%edx)
+ 824:	eb b9                	jmp    7df <malloc+0x9f>
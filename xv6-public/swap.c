@@ -0,0 +1,580 @@
+// Swapping of anonymous user pages.
+//
+// The swap area is a run of disk blocks after the file system
+// (see sb.swapstart and sb.nswap), divided into page-sized slots.
+// When memory runs out, reclaim() picks user pages with a clock
+// sweep over the process table, writes each to a free slot and
+// replaces its PTE with a swap entry (SWAPPTE), keeping the
+// PTE_U/PTE_W/PTE_OW bits. A fault on a swap entry reads the
+// page back into a private frame (swapin). zswap.c keeps
+// compressed copies of pages in memory, so only pages it turns
+// away are written to disk; slots without disk blocks behind
+// them (beyond ndisk) can only hold such copies.
+//
+// Slots are reference counted: fork copies swap entries and
+// bumps the count, so parent and child each fault in their own
+// copy of the contents the page had when it was swapped out.
+// A COW-shared frame is evicted one mapping at a time; it is
+// freed once every sharer has been evicted or has broken the
+// share.
+//
+// Only pages of processes that cannot be touching user memory
+// with a spinlock held are taken: the calling process itself,
+// processes preempted in user mode, and processes sleeping in
+// wait() or sleep(). (piperead() and the console copy to and
+// from user memory under a spinlock, where a fault cannot sleep
+// to swap the page back in; argptr() swaps a buffer in before
+// such a system call starts.)
+//
+// The owner's resident page counts (p->rss, or the region's
+// nloaded) are kept up to date on both swap-out and swap-in.
+//
+// Unmapped pages of the page cache (pagecache.c) are the first
+// to go.
+//
+// Pages of file-backed wmap regions are not swapped: reclaim()
+// unmaps them and lets the page cache drop them, and the next
+// fault reads them from the file again. Only this kind of page is
+// taken when free memory merely falls below RECLAIMLOW
+// (reclaimlow()); anonymous pages are swapped only when memory
+// has run out.
+//
+// reclaim() runs inside allocations, where the caller may be in
+// a transaction or hold inode and buffer locks (exec, or a fault
+// in writei()'s copy from user memory), so it cannot write dirty
+// file pages back: that needs begin_op() and ilock(). It passes
+// them over and wakes the writeback kernel thread, which writes
+// them back and drops them while free memory is low.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "file.h"
+
+#define SPP       (PGSIZE/BSIZE)     // disk blocks per swap slot
+#define NSWAPSLOT (SWAPSIZE/SPP)
+#define SCANMAX   4096               // PTEs looked at per victim search
+#define SCANTRIES (2*NPAGES/SCANMAX) // searches past used pages per reclaim
+#define SWAPBATCH 16                 // pages swapped out per reclaim
+#define RECLAIMLOW 64                // free pages below which file pages go
+
+extern unsigned char pagerefs[NPAGES];
+extern pte_t* walkpgdir(pde_t *pgdir, const void *va, int alloc);
+
+struct {
+  struct spinlock lock;       // protects ref[] and hint
+  struct sleeplock iolock;    // protects buf[]
+  struct sleeplock reclaimlock; // one reclaimer at a time
+  uint dev;
+  uint start;                 // first block of the swap area
+  uint nslot;
+  uint ndisk;                 // slots [0, ndisk) have disk blocks
+  uint hint;                  // where to look for a free slot
+  uchar ref[NSWAPSLOT];       // swap entries referring to each slot
+  struct buf buf[SPP];        // one slot's blocks
+
+  // Clock hand of the victim search.
+  int handproc;
+  uint handva;
+
+  uint nswapout;
+  uint nswapin;
+  uint ndropped;              // file pages unmapped
+  uint nwriteback;            // ... of which written back first
+
+  int wbwanted;               // dirty file pages were passed over
+  int wbkick;                 // the writeback thread has work
+} swap;
+
+// A page picked for eviction.
+struct victim {
+  struct proc *p;
+  int pid;
+  uint va;
+  uint pa;
+  struct mmap *m;             // wmap region, or 0
+  struct file *file;          // reference to m->file, if any
+  uint off;                   // offset of the page in file
+  int dirty;
+};
+
+static void writeback(void);
+
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+  int i;
+
+  initlock(&swap.lock, "swap");
+  initsleeplock(&swap.iolock, "swapio");
+  initsleeplock(&swap.reclaimlock, "reclaim");
+  for(i = 0; i < SPP; i++)
+    initsleeplock(&swap.buf[i].lock, "swapbuf");
+  readsb(dev, &sb);
+  swap.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = NSWAPSLOT;
+  swap.ndisk = sb.nswap / SPP;
+  if(swap.ndisk > NSWAPSLOT)
+    swap.ndisk = NSWAPSLOT;
+  zswapinit();
+  if(kthread("writeback", writeback) < 0)
+    panic("swapinit: writeback");
+  cprintf("swap: %d slots, %d on disk at block %d\n",
+          swap.nslot, swap.ndisk, swap.start);
+}
+
+// Allocate a swap slot with one reference. Returns -1 if full.
+static int
+slotalloc(void)
+{
+  uint i, s;
+
+  acquire(&swap.lock);
+  for(i = 0; i < swap.nslot; i++){
+    s = (swap.hint + i) % swap.nslot;
+    if(swap.ref[s] == 0){
+      swap.ref[s] = 1;
+      swap.hint = s + 1;
+      release(&swap.lock);
+      return s;
+    }
+  }
+  release(&swap.lock);
+  return -1;
+}
+
+// Add a reference to a slot, for a copied swap entry.
+void
+swapdup(uint slot)
+{
+  acquire(&swap.lock);
+  if(slot >= swap.nslot || swap.ref[slot] == 0)
+    panic("swapdup");
+  swap.ref[slot]++;
+  release(&swap.lock);
+}
+
+// Drop a reference to a slot.
+void
+swapfree(uint slot)
+{
+  int last;
+
+  acquire(&swap.lock);
+  if(slot >= swap.nslot || swap.ref[slot] == 0)
+    panic("swapfree");
+  last = --swap.ref[slot] == 0;
+  release(&swap.lock);
+  if(last)
+    zswapdrop(slot);
+}
+
+// Read or write the page at slot, in one request to the
+// disk for the slot's consecutive blocks.
+static void
+swaprw(uint slot, char *page, int write)
+{
+  struct buf *b, *bv[SPP];
+  int i;
+
+  acquiresleep(&swap.iolock);
+  for(i = 0; i < SPP; i++){
+    b = bv[i] = &swap.buf[i];
+    acquiresleep(&b->lock);
+    b->dev = swap.dev;
+    b->blockno = swap.start + slot*SPP + i;
+    if(write){
+      memmove(b->data, page + i*BSIZE, BSIZE);
+      b->flags = B_DIRTY;
+    } else {
+      b->flags = 0;
+    }
+  }
+  iderwv(bv, SPP);
+  for(i = 0; i < SPP; i++){
+    b = bv[i];
+    if(!write)
+      memmove(page + i*BSIZE, b->data, BSIZE);
+    releasesleep(&b->lock);
+  }
+  releasesleep(&swap.iolock);
+}
+
+// Can p's pages be taken, or its page table changed under it?
+// Also used by ksm.c. Caller holds the process table lock.
+int
+swappable(struct proc *p)
+{
+  if(p->pgdir == 0 || p->pid == 0)
+    return 0;
+  if(p == myproc())
+    return 1;
+  if(p->state == RUNNABLE)
+    return p->preempted;
+  return p->state == SLEEPING && (p->chan == p || p->chan == &ticks);
+}
+
+// Smallest address >= va of p that may hold reclaimable memory:
+// the process image or a wmap region. Sets *mp to the region,
+// or 0 for the process image. Returns KERNBASE if there is none.
+static uint
+nextuva(struct proc *p, uint va, struct mmap **mp)
+{
+  struct mmap *m;
+  uint next;
+
+  *mp = 0;
+  if(va < p->sz)
+    return va;
+  next = KERNBASE;
+  for(m = p->mmaps; m < &p->mmaps[MAX_WMMAP_INFO]; m++){
+    if(m->addr == -1)
+      continue;
+    if(va < m->addr){
+      if(m->addr < next){
+        next = m->addr;
+        *mp = m;
+      }
+    } else if(va < m->addr + m->length){
+      *mp = m;
+      return va;
+    }
+  }
+  return next;
+}
+
+// Advance the clock hand to the next page, choosing a present
+// page that has not been accessed since the hand last passed
+// it: a page of a file-backed region, clean unless wb is set,
+// or if anon is set a user-writable anonymous page. Frames
+// shared with other mappings are only taken if shared is set,
+// and then only COW ones. The chosen page is pinned with an
+// extra reference and its dirty bit is cleared. Caller holds
+// the process table lock. Returns 1 if a page was chosen, 0 if
+// none was, or -1 if none was but some were given a second
+// chance, so that searching on may find one.
+static int
+pickvictim(struct victim *v, int anon, int shared, int wb)
+{
+  struct proc *p;
+  struct mmap *m;
+  pte_t *pte;
+  uint va, pa;
+  int n, flush, aged;
+
+  flush = 0;
+  aged = 0;
+  for(n = 0; n < SCANMAX; n++){
+    p = procslot(swap.handproc);
+    va = KERNBASE;
+    if(swappable(p))
+      va = nextuva(p, swap.handva, &m);
+    if(va >= KERNBASE){
+      swap.handproc = (swap.handproc + 1) % NPROC;
+      swap.handva = 0;
+      continue;
+    }
+    swap.handva = va + PGSIZE;
+    if((pte = walkpgdir(p->pgdir, (void*)va, 0)) == 0){
+      swap.handva = PGADDR(PDX(va) + 1, 0, 0);
+      continue;
+    }
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+      continue;
+    pa = PTE_ADDR(*pte);
+    if(m && m->file){
+      // Dirty pages need a file to write back to. A frame
+      // mapped elsewhere besides the page cache stays.
+      if(pagerefs[PFN(pa)] > 2 || ((*pte & PTE_D) && !m->file->writable))
+        continue;
+      if((*pte & PTE_D) && !wb){
+        swap.wbwanted = 1;
+        continue;
+      }
+    } else {
+      if(!anon || !(*pte & (PTE_W|PTE_OW)))
+        continue;
+      if(pagerefs[PFN(pa)] > 1 && !(shared && (*pte & PTE_OW)))
+        continue;
+    }
+    if(agepage(pte) == 0){
+      // Second chance: used since the last scan or pass.
+      flush |= p == myproc();
+      aged = 1;
+      continue;
+    }
+    v->dirty = (*pte & PTE_D) != 0;
+    *pte &= ~PTE_D;
+    if(p == myproc())
+      lcr3(V2P(p->pgdir));
+    pagerefs[PFN(pa)]++;
+    v->p = p;
+    v->pid = p->pid;
+    v->va = va;
+    v->pa = pa;
+    v->m = m;
+    v->file = 0;
+    if(m && m->file){
+      v->file = filedup(m->file);
+      v->off = va - m->addr;
+    }
+    return 1;
+  }
+  if(flush)
+    lcr3(V2P(myproc()->pgdir));
+  return aged ? -1 : 0;
+}
+
+// Save the pinned victim page (to swap, or to its file if it
+// is dirty) and, if its mapping has not changed meanwhile,
+// replace the mapping with a swap entry or drop it.
+// Returns 1 if the page was freed from the mapping.
+static int
+evict(struct victim *v)
+{
+  struct proc *p = v->p;
+  pte_t *pte;
+  int slot, saved, done;
+
+  slot = -1;
+  if(v->file)
+    saved = !v->dirty || filewriteat(v->file, P2V(v->pa), PGSIZE, v->off) >= 0;
+  else if((saved = (slot = slotalloc()) >= 0) &&
+          zswapstore(slot, P2V(v->pa)) < 0){
+    if(slot < swap.ndisk)
+      swaprw(slot, P2V(v->pa), 1);
+    else
+      saved = 0;
+  }
+
+  done = 0;
+  lockptable();
+  if(p->pid == v->pid && swappable(p) &&
+     (pte = walkpgdir(p->pgdir, (void*)v->va, 0)) != 0 &&
+     (*pte & PTE_P) && PTE_ADDR(*pte) == v->pa){
+    if(!saved){
+      if(v->dirty)
+        *pte |= PTE_D;
+    } else if(!(*pte & PTE_D)){
+      if(v->file)
+        *pte = 0;
+      else
+        *pte = SWAPPTE(slot) | (*pte & (PTE_U|PTE_W|PTE_OW));
+      if(v->m)
+        v->m->nloaded--;
+      else
+        p->rss--;
+      if(p == myproc())
+        lcr3(V2P(p->pgdir));
+      done = 1;
+    }
+  }
+  unlockptable();
+
+  if(done){
+    kfree(P2V(v->pa));  // the mapping's reference
+    if(v->file == 0){
+      swap.nswapout++;
+      vmcount(VM_SWAPOUT, 1);
+    } else {
+      swap.ndropped++;
+      if(v->dirty)
+        swap.nwriteback++;
+    }
+  } else if(slot >= 0) {
+    swapfree(slot);
+  }
+  kfree(P2V(v->pa));    // the pin
+  if(v->file){
+    // A page cache frame is only freed once the cache lets go.
+    if(done)
+      pcachedrop(v->file->ip, v->off/PGSIZE);
+    fileclose(v->file);
+  }
+  return done;
+}
+
+// Pick and evict up to n pages, as reclaim() describes; dirty
+// file pages only if wb is set. When every page in reach was
+// used recently, one search only clears their accessed bits,
+// so keep going for about two turns of the clock.
+static int
+reclaimpages(int n, int anon, int wb)
+{
+  struct victim v;
+  int done, shared, r, tries;
+
+  done = 0;
+  for(shared = 0; shared < 1 + anon && done < n; shared++){
+    tries = 0;
+    while(done < n){
+      lockptable();
+      if((r = pickvictim(&v, anon, shared, wb)) <= 0){
+        unlockptable();
+        if(r < 0 && ++tries < SCANTRIES)
+          continue;
+        break;
+      }
+      unlockptable();
+      done += evict(&v);
+    }
+  }
+  return done;
+}
+
+// Free up to n pages from user mappings: unmapped page cache
+// pages, clean file-backed pages, and if anon is set anonymous
+// pages too, swapping them out. Returns the number freed. May
+// sleep; the caller must not hold spinlocks.
+int
+reclaim(int n, int anon)
+{
+  int done;
+
+  acquiresleep(&swap.reclaimlock);
+  done = pcacheshrink(n);
+  if(done < n)
+    done += reclaimpages(n - done, anon, 0);
+  releasesleep(&swap.reclaimlock);
+
+  acquire(&swap.lock);
+  if(swap.wbwanted){
+    swap.wbwanted = 0;
+    swap.wbkick = 1;
+    wakeup(&swap.wbkick);
+  }
+  release(&swap.lock);
+  return done;
+}
+
+// Body of the writeback kernel thread: while free memory is
+// low, write dirty file pages back and drop them. It holds no
+// locks or transaction of its own to begin with, so begin_op()
+// and ilock() are safe here. It leaves reclaimlock alone, since
+// the reclaimer holding it may be in the transaction that
+// begin_op() waits for.
+static void
+writeback(void)
+{
+  for(;;){
+    acquire(&swap.lock);
+    while(!swap.wbkick)
+      sleep(&swap.wbkick, &swap.lock);
+    swap.wbkick = 0;
+    release(&swap.lock);
+    while(kfreecount() < RECLAIMLOW*2 &&
+          reclaimpages(SWAPBATCH, 0, 1) > 0)
+      ;
+  }
+}
+
+// If free memory has fallen below the watermark, unmap some
+// file-backed pages. Called on allocation paths for user
+// memory; the caller must not hold spinlocks.
+void
+reclaimlow(void)
+{
+  if(kfreecount() < RECLAIMLOW)
+    reclaim(SWAPBATCH, 0);
+}
+
+// Like kalloc_zeroed() if zero is set, else kalloc(), but when
+// memory is exhausted swap pages out and try again. Only
+// reclaims if the caller holds no spinlocks (e.g. a fault taken
+// inside piperead()).
+char*
+kalloc_reclaim(int zero)
+{
+  char *mem;
+  int locked;
+
+  mem = zero ? kalloc_zeroed() : kalloc();
+  pushcli();
+  locked = mycpu()->ncli > 1;
+  popcli();
+  if(locked || myproc() == 0)
+    return mem;
+  if(mem){
+    reclaimlow();
+    return mem;
+  }
+  if(reclaim(SWAPBATCH, 1) == 0)
+    return 0;
+  return zero ? kalloc_zeroed() : kalloc();
+}
+
+// Bring the page at va back in from swap. pgdir is the
+// calling process's. Returns 0 on success, -1 if out of memory.
+int
+swapin(pde_t *pgdir, uint va)
+{
+  struct mmap *m;
+  pte_t *pte;
+  uint slot, perm;
+  char *mem;
+
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0 || !SWAPPED(*pte))
+    return 0;
+  slot = SWAPSLOT(*pte);
+  if((mem = kalloc_reclaim(0)) == 0)
+    return -1;
+  if(zswapload(slot, mem) < 0)
+    swaprw(slot, mem, 0);
+  // Only this process changes its own swap entries, so *pte
+  // is still the same. The new frame is private, so a page
+  // that was COW-shared becomes plainly writable.
+  perm = PTE_U;
+  if(*pte & (PTE_W|PTE_OW))
+    perm |= PTE_W;
+  *pte = V2P(mem) | perm | PTE_P;
+  nextuva(myproc(), va, &m);
+  if(m)
+    m->nloaded++;
+  else
+    myproc()->rss++;
+  swapfree(slot);
+  swap.nswapin++;
+  vmcount(VM_SWAPIN, 1);
+  lcr3(V2P(pgdir));
+  return 0;
+}
+
+// Swap in every swapped-out page in [va, va+n).
+int
+swapinrange(pde_t *pgdir, uint va, uint n)
+{
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE)
+    if(swapin(pgdir, a) < 0)
+      return -1;
+  return 0;
+}
+
+// Print swap usage. Runs on ^P; no lock to avoid
+// wedging a stuck machine further.
+void
+swapdump(void)
+{
+  uint i, used;
+
+  used = 0;
+  for(i = 0; i < swap.nslot; i++)
+    if(swap.ref[i])
+      used++;
+  cprintf("swap: %d/%d slots used, %d out, %d in\n",
+          used, swap.nslot, swap.nswapout, swap.nswapin);
+  cprintf(" file pages dropped: %d, written back: %d\n",
+          swap.ndropped, swap.nwriteback);
+  zswapdump();
+}
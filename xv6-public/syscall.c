@@ -65,6 +65,10 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
     return -1;
+  // Some callers copy to or from the buffer while holding a
+  // spinlock, where a fault could not wait for the disk.
+  if(swapinrange(curproc->pgdir, i, size) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
@@ -107,6 +111,13 @@ extern int sys_wmap(void);
 extern int sys_wunmap(void);
 extern int sys_va2pa(void);
 extern int sys_getwmapinfo(void);
+extern int sys_getwssinfo(void);
+extern int sys_setmergeable(void);
+extern int sys_getvmstat(void);
+extern int sys_getfaulthist(void);
+extern int sys_getprocinfo(void);
+extern int sys_spawn(void);
+extern int sys_fsync(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]         sys_fork,
@@ -134,6 +145,13 @@ static int (*syscalls[])(void) = {
 [SYS_wunmap]       sys_wunmap,
 [SYS_va2pa]        sys_va2pa,
 [SYS_getwmapinfo]  sys_getwmapinfo,
+[SYS_getwssinfo]   sys_getwssinfo,
+[SYS_setmergeable] sys_setmergeable,
+[SYS_getvmstat]    sys_getvmstat,
+[SYS_getfaulthist] sys_getfaulthist,
+[SYS_getprocinfo]  sys_getprocinfo,
+[SYS_spawn]        sys_spawn,
+[SYS_fsync]        sys_fsync,
 };
 
 void
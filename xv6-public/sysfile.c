@@ -114,6 +114,19 @@ sys_fstat(void)
   return filestat(f, st);
 }
 
+// Wait until what has been written is safely on disk. The log
+// covers the whole file system, so fd only has to be open.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  logsync();
+  return 0;
+}
+
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
@@ -271,15 +284,27 @@ create(char *path, short type, short major, short minor)
     iupdate(dp);
     // No ip->nlink++ for ".": avoid cyclic ref count.
     if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
-      panic("create dots");
+      goto bad;
   }
 
   if(dirlink(dp, name, ip->inum) < 0)
-    panic("create: dirlink");
+    goto bad;
 
   iunlockput(dp);
 
   return ip;
+
+bad:
+  // The disk is full. iput() frees ip and its blocks.
+  if(type == T_DIR){
+    dp->nlink--;
+    iupdate(dp);
+  }
+  ip->nlink = 0;
+  iupdate(ip);
+  iunlockput(ip);
+  iunlockput(dp);
+  return 0;
 }
 
 int
@@ -419,6 +444,42 @@ sys_exec(void)
   return exec(path, argv);
 }
 
+// spawn(path, argv, fds, nfds): see spawn() in proc.c. With
+// fds null, the child gets the caller's descriptors 0, 1 and 2.
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  int i, nfds, *ufds, fds[NOFILE];
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+     argint(3, &nfds) < 0 || nfds < 0 || nfds > NOFILE ||
+     argptr(2, (char**)&ufds, nfds*sizeof(int)) < 0){
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+  for(i=0;; i++){
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+      return -1;
+    if(uarg == 0){
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+      return -1;
+  }
+  if(ufds == 0){
+    for(nfds = 0; nfds < 3; nfds++)
+      fds[nfds] = myproc()->ofile[nfds] ? nfds : -1;
+  } else {
+    memmove(fds, ufds, nfds*sizeof(int));
+  }
+  return spawn(path, argv, fds, nfds);
+}
+
 int
 sys_pipe(void)
 {
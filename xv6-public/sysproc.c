@@ -146,6 +146,7 @@ sys_wmap(void) {
   p_mmaps[free].length = length;
   p_mmaps[free].flags = flags;
   p_mmaps[free].file = file != 0 ? filedup(file) : 0;
+  p_mmaps[free].hot = 0;
   return addr;
 }
 
@@ -184,12 +185,22 @@ sys_wunmap(void) {
   for (i = 0; i < PGROUNDUP(length) / PGSIZE; i++) {
     // va in user va space -> pa -> pa in kernel va space
     pte_t *pte = walkpgdir(pgdir, (void*)addr + i*PGSIZE, 0);
+    if (pte && SWAPPED(*pte)) {
+      swapfree(SWAPSLOT(*pte));
+      *pte = 0;
+      continue;
+    }
     if (pte == 0 || !(*pte & PTE_P)) continue;
     uint pa = PTE_ADDR(*pte);
     char* pva = P2V(pa);
-    if (file != 0) filewrite(file, pva, PGSIZE);
+    if (file != 0) {
+      // pages may have been reclaimed, so seek to each one
+      file->off = i*PGSIZE;
+      filewrite(file, pva, PGSIZE);
+    }
     kfree(pva);
     *pte = 0;
+    vmcount(VM_WUNMAP, 1);
   }
   p_mmaps[entry].addr = -1;
   p_mmaps[entry].nloaded = 0;
@@ -240,3 +251,76 @@ sys_getwmapinfo(void) {
   wminfo->total_mmaps = total_mmaps;
   return SUCCESS;
 }
+
+int
+sys_getwssinfo(void) {
+  int pid;
+  struct wssinfo *wsinfo;
+  struct wssinfo wi;
+
+  if (argint(0, &pid) < 0 ||
+    argptr(1, (void *)&wsinfo, sizeof(struct wssinfo)) < 0)
+    return FAILED;
+
+  if (wsinfo == 0 || getwss(pid, &wi) < 0)
+    return FAILED;
+
+  *wsinfo = wi;
+  return SUCCESS;
+}
+
+// Opt the calling process, and children it forks later, in or
+// out of same-page merging (see ksm.c).
+int
+sys_setmergeable(void) {
+  int on;
+
+  if (argint(0, &on) < 0)
+    return FAILED;
+  myproc()->mergeable = on != 0;
+  return SUCCESS;
+}
+
+int
+sys_getvmstat(void) {
+  struct vmstat *vsinfo;
+  struct vmstat vs;
+  int size;
+
+  if (argint(1, &size) < 0 || size < 0 ||
+    argptr(0, (void *)&vsinfo, size) < 0)
+    return FAILED;
+
+  // Older callers may pass a smaller struct.
+  getvmstat(&vs);
+  if (size > sizeof(vs))
+    size = sizeof(vs);
+  memmove(vsinfo, &vs, size);
+  return size;
+}
+
+int
+sys_getfaulthist(void) {
+  struct faulthist *fhinfo;
+  int reset;
+
+  if (argptr(0, (void *)&fhinfo, sizeof(struct faulthist)) < 0 ||
+    argint(1, &reset) < 0)
+    return FAILED;
+
+  getfaulthist(fhinfo, reset);
+  return SUCCESS;
+}
+
+// Describe up to n processes in pi[]. Returns how many were.
+int
+sys_getprocinfo(void) {
+  struct procinfo *pinfo;
+  int n;
+
+  if (argint(1, &n) < 0 || n < 0 || n > NPROC ||
+    argptr(0, (void *)&pinfo, n * sizeof(struct procinfo)) < 0)
+    return FAILED;
+
+  return getprocinfo(pinfo, n);
+}
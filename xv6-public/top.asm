@@ -0,0 +1,1676 @@
+
+_top:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int n, interval, count;
+
+  if(argc > 3){
+  19:	83 fb 03             	cmp    $0x3,%ebx
+  1c:	0f 8f bb 00 00 00    	jg     dd <main+0xdd>
+    printf(2, "usage: top [interval [count]]\n");
+    exit();
+  }
+  interval = argc > 1 ? atoi(argv[1]) : 100;
+  22:	83 fb 01             	cmp    $0x1,%ebx
+  25:	0f 8f 86 00 00 00    	jg     b1 <main+0xb1>
+  if(interval <= 0){
+    printf(2, "top: bad interval\n");
+    exit();
+  }
+
+  nnew = getprocinfo(new, NPROC);
+  2b:	50                   	push   %eax
+  interval = argc > 1 ? atoi(argv[1]) : 100;
+  2c:	be 64 00 00 00       	mov    $0x64,%esi
+  count = argc > 2 ? atoi(argv[2]) : 0;
+  31:	31 ff                	xor    %edi,%edi
+  nnew = getprocinfo(new, NPROC);
+  33:	50                   	push   %eax
+  34:	6a 40                	push   $0x40
+  36:	68 20 21 00 00       	push   $0x2120
+  3b:	e8 c3 07 00 00       	call   803 <getprocinfo>
+  for(n = 0; count == 0 || n < count; n++){
+  40:	c6 45 e7 01          	movb   $0x1,-0x19(%ebp)
+  nnew = getprocinfo(new, NPROC);
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	a3 00 20 00 00       	mov    %eax,0x2000
+  for(n = 0; count == 0 || n < count; n++){
+  4c:	31 db                	xor    %ebx,%ebx
+  4e:	66 90                	xchg   %ax,%ax
+    memmove(old, new, sizeof(new));
+  50:	83 ec 04             	sub    $0x4,%esp
+  53:	68 00 0f 00 00       	push   $0xf00
+  58:	68 20 21 00 00       	push   $0x2120
+  5d:	68 20 30 00 00       	push   $0x3020
+  62:	e8 89 06 00 00       	call   6f0 <memmove>
+    nold = nnew;
+  67:	a1 00 20 00 00       	mov    0x2000,%eax
+    sleep(interval);
+  6c:	89 34 24             	mov    %esi,(%esp)
+    nold = nnew;
+  6f:	a3 04 20 00 00       	mov    %eax,0x2004
+    sleep(interval);
+  74:	e8 3a 07 00 00       	call   7b3 <sleep>
+    if((nnew = getprocinfo(new, NPROC)) < 0){
+  79:	59                   	pop    %ecx
+  7a:	58                   	pop    %eax
+  7b:	6a 40                	push   $0x40
+  7d:	68 20 21 00 00       	push   $0x2120
+  82:	e8 7c 07 00 00       	call   803 <getprocinfo>
+  87:	83 c4 10             	add    $0x10,%esp
+  8a:	a3 00 20 00 00       	mov    %eax,0x2000
+  8f:	85 c0                	test   %eax,%eax
+  91:	78 5d                	js     f0 <main+0xf0>
+      printf(2, "top: getprocinfo failed\n");
+      exit();
+    }
+    show(interval);
+  93:	83 ec 0c             	sub    $0xc,%esp
+  for(n = 0; count == 0 || n < count; n++){
+  96:	83 c3 01             	add    $0x1,%ebx
+    show(interval);
+  99:	56                   	push   %esi
+  9a:	e8 11 01 00 00       	call   1b0 <show>
+  for(n = 0; count == 0 || n < count; n++){
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	39 fb                	cmp    %edi,%ebx
+  a4:	7c aa                	jl     50 <main+0x50>
+  a6:	80 7d e7 00          	cmpb   $0x0,-0x19(%ebp)
+  aa:	75 a4                	jne    50 <main+0x50>
+  }
+  exit();
+  ac:	e8 72 06 00 00       	call   723 <exit>
+  interval = argc > 1 ? atoi(argv[1]) : 100;
+  b1:	83 ec 0c             	sub    $0xc,%esp
+  b4:	ff 77 04             	push   0x4(%edi)
+  b7:	e8 f4 05 00 00       	call   6b0 <atoi>
+  count = argc > 2 ? atoi(argv[2]) : 0;
+  bc:	83 c4 10             	add    $0x10,%esp
+  interval = argc > 1 ? atoi(argv[1]) : 100;
+  bf:	89 c6                	mov    %eax,%esi
+  count = argc > 2 ? atoi(argv[2]) : 0;
+  c1:	83 fb 03             	cmp    $0x3,%ebx
+  c4:	74 3d                	je     103 <main+0x103>
+  if(interval <= 0){
+  c6:	85 c0                	test   %eax,%eax
+  c8:	7f 74                	jg     13e <main+0x13e>
+    printf(2, "top: bad interval\n");
+  ca:	50                   	push   %eax
+  cb:	50                   	push   %eax
+  cc:	68 af 10 00 00       	push   $0x10af
+  d1:	6a 02                	push   $0x2
+  d3:	e8 e8 07 00 00       	call   8c0 <printf>
+    exit();
+  d8:	e8 46 06 00 00       	call   723 <exit>
+    printf(2, "usage: top [interval [count]]\n");
+  dd:	50                   	push   %eax
+  de:	50                   	push   %eax
+  df:	68 90 10 00 00       	push   $0x1090
+  e4:	6a 02                	push   $0x2
+  e6:	e8 d5 07 00 00       	call   8c0 <printf>
+    exit();
+  eb:	e8 33 06 00 00       	call   723 <exit>
+      printf(2, "top: getprocinfo failed\n");
+  f0:	52                   	push   %edx
+  f1:	52                   	push   %edx
+  f2:	68 c2 10 00 00       	push   $0x10c2
+  f7:	6a 02                	push   $0x2
+  f9:	e8 c2 07 00 00       	call   8c0 <printf>
+      exit();
+  fe:	e8 20 06 00 00       	call   723 <exit>
+  count = argc > 2 ? atoi(argv[2]) : 0;
+ 103:	83 ec 0c             	sub    $0xc,%esp
+ 106:	ff 77 08             	push   0x8(%edi)
+ 109:	e8 a2 05 00 00       	call   6b0 <atoi>
+  if(interval <= 0){
+ 10e:	83 c4 10             	add    $0x10,%esp
+  count = argc > 2 ? atoi(argv[2]) : 0;
+ 111:	89 c7                	mov    %eax,%edi
+  if(interval <= 0){
+ 113:	85 f6                	test   %esi,%esi
+ 115:	7e b3                	jle    ca <main+0xca>
+  nnew = getprocinfo(new, NPROC);
+ 117:	50                   	push   %eax
+ 118:	50                   	push   %eax
+ 119:	6a 40                	push   $0x40
+ 11b:	68 20 21 00 00       	push   $0x2120
+ 120:	e8 de 06 00 00       	call   803 <getprocinfo>
+  for(n = 0; count == 0 || n < count; n++){
+ 125:	83 c4 10             	add    $0x10,%esp
+  nnew = getprocinfo(new, NPROC);
+ 128:	a3 00 20 00 00       	mov    %eax,0x2000
+  for(n = 0; count == 0 || n < count; n++){
+ 12d:	85 ff                	test   %edi,%edi
+ 12f:	0f 88 77 ff ff ff    	js     ac <main+0xac>
+ 135:	0f 94 45 e7          	sete   -0x19(%ebp)
+ 139:	e9 0e ff ff ff       	jmp    4c <main+0x4c>
+  nnew = getprocinfo(new, NPROC);
+ 13e:	50                   	push   %eax
+  count = argc > 2 ? atoi(argv[2]) : 0;
+ 13f:	31 ff                	xor    %edi,%edi
+  nnew = getprocinfo(new, NPROC);
+ 141:	50                   	push   %eax
+ 142:	6a 40                	push   $0x40
+ 144:	68 20 21 00 00       	push   $0x2120
+ 149:	e8 b5 06 00 00       	call   803 <getprocinfo>
+  for(n = 0; count == 0 || n < count; n++){
+ 14e:	c6 45 e7 01          	movb   $0x1,-0x19(%ebp)
+  nnew = getprocinfo(new, NPROC);
+ 152:	83 c4 10             	add    $0x10,%esp
+ 155:	a3 00 20 00 00       	mov    %eax,0x2000
+  for(n = 0; count == 0 || n < count; n++){
+ 15a:	e9 ed fe ff ff       	jmp    4c <main+0x4c>
+ 15f:	90                   	nop
+
+00000160 <ran>:
+{
+ 160:	55                   	push   %ebp
+  for(i = 0; i < nold; i++)
+ 161:	8b 0d 04 20 00 00    	mov    0x2004,%ecx
+{
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	56                   	push   %esi
+ 16a:	53                   	push   %ebx
+ 16b:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(i = 0; i < nold; i++)
+ 16e:	85 c9                	test   %ecx,%ecx
+ 170:	7e 2e                	jle    1a0 <ran+0x40>
+    if(old[i].pid == pi->pid)
+ 172:	8b 1e                	mov    (%esi),%ebx
+  for(i = 0; i < nold; i++)
+ 174:	31 c0                	xor    %eax,%eax
+ 176:	eb 0f                	jmp    187 <ran+0x27>
+ 178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	39 c8                	cmp    %ecx,%eax
+ 185:	74 19                	je     1a0 <ran+0x40>
+    if(old[i].pid == pi->pid)
+ 187:	6b d0 3c             	imul   $0x3c,%eax,%edx
+ 18a:	39 9a 20 30 00 00    	cmp    %ebx,0x3020(%edx)
+ 190:	75 ee                	jne    180 <ran+0x20>
+      return pi->ticks - old[i].ticks;
+ 192:	8b 46 38             	mov    0x38(%esi),%eax
+}
+ 195:	5b                   	pop    %ebx
+      return pi->ticks - old[i].ticks;
+ 196:	2b 82 58 30 00 00    	sub    0x3058(%edx),%eax
+}
+ 19c:	5e                   	pop    %esi
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  return pi->ticks;
+ 1a0:	8b 46 38             	mov    0x38(%esi),%eax
+}
+ 1a3:	5b                   	pop    %ebx
+ 1a4:	5e                   	pop    %esi
+ 1a5:	5d                   	pop    %ebp
+ 1a6:	c3                   	ret
+ 1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <show>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	83 ec 6c             	sub    $0x6c,%esp
+  for(i = 0; i < nnew; i++)
+ 1b9:	a1 00 20 00 00       	mov    0x2000,%eax
+ 1be:	89 45 a0             	mov    %eax,-0x60(%ebp)
+ 1c1:	85 c0                	test   %eax,%eax
+ 1c3:	0f 8e 05 03 00 00    	jle    4ce <show+0x31e>
+  for(i = 0; i < nold; i++)
+ 1c9:	8b 1d 04 20 00 00    	mov    0x2004,%ebx
+ 1cf:	bf 58 21 00 00       	mov    $0x2158,%edi
+  for(i = 0; i < nnew; i++)
+ 1d4:	31 f6                	xor    %esi,%esi
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < nold; i++)
+ 1e0:	85 db                	test   %ebx,%ebx
+ 1e2:	0f 8e d0 02 00 00    	jle    4b8 <show+0x308>
+    if(old[i].pid == pi->pid)
+ 1e8:	8b 4f c8             	mov    -0x38(%edi),%ecx
+  for(i = 0; i < nold; i++)
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	eb 0c                	jmp    1fb <show+0x4b>
+ 1ef:	90                   	nop
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	39 d8                	cmp    %ebx,%eax
+ 1f5:	0f 84 bd 02 00 00    	je     4b8 <show+0x308>
+    if(old[i].pid == pi->pid)
+ 1fb:	6b d0 3c             	imul   $0x3c,%eax,%edx
+ 1fe:	39 8a 20 30 00 00    	cmp    %ecx,0x3020(%edx)
+ 204:	75 ea                	jne    1f0 <show+0x40>
+      return pi->ticks - old[i].ticks;
+ 206:	8b 07                	mov    (%edi),%eax
+ 208:	2b 82 58 30 00 00    	sub    0x3058(%edx),%eax
+    cpu[i] = ran(&new[i]);
+ 20e:	89 04 b5 20 20 00 00 	mov    %eax,0x2020(,%esi,4)
+  for(i = 0; i < nnew; i++)
+ 215:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 218:	83 c6 01             	add    $0x1,%esi
+ 21b:	83 c7 3c             	add    $0x3c,%edi
+ 21e:	39 c6                	cmp    %eax,%esi
+ 220:	75 be                	jne    1e0 <show+0x30>
+  for(i = 1; i < nnew; i++){
+ 222:	bf 01 00 00 00       	mov    $0x1,%edi
+ 227:	83 7d a0 01          	cmpl   $0x1,-0x60(%ebp)
+ 22b:	b9 5c 21 00 00       	mov    $0x215c,%ecx
+ 230:	89 fb                	mov    %edi,%ebx
+ 232:	0f 84 92 01 00 00    	je     3ca <show+0x21a>
+ 238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+    t = new[i];
+ 240:	8b 01                	mov    (%ecx),%eax
+ 242:	8b 71 24             	mov    0x24(%ecx),%esi
+ 245:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+    c = cpu[i];
+ 248:	89 da                	mov    %ebx,%edx
+ 24a:	8b 3c 9d 20 20 00 00 	mov    0x2020(,%ebx,4),%edi
+    t = new[i];
+ 251:	89 45 ac             	mov    %eax,-0x54(%ebp)
+ 254:	8b 41 04             	mov    0x4(%ecx),%eax
+ 257:	89 f3                	mov    %esi,%ebx
+ 259:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 25c:	89 45 b0             	mov    %eax,-0x50(%ebp)
+ 25f:	8b 41 08             	mov    0x8(%ecx),%eax
+ 262:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+ 265:	8b 41 0c             	mov    0xc(%ecx),%eax
+ 268:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 26b:	8b 41 10             	mov    0x10(%ecx),%eax
+ 26e:	89 45 bc             	mov    %eax,-0x44(%ebp)
+ 271:	8b 41 14             	mov    0x14(%ecx),%eax
+ 274:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 277:	8b 41 18             	mov    0x18(%ecx),%eax
+ 27a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 27d:	8b 41 1c             	mov    0x1c(%ecx),%eax
+ 280:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 283:	8b 41 20             	mov    0x20(%ecx),%eax
+ 286:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 289:	8b 41 28             	mov    0x28(%ecx),%eax
+ 28c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 28f:	8b 41 2c             	mov    0x2c(%ecx),%eax
+ 292:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 295:	8b 41 30             	mov    0x30(%ecx),%eax
+ 298:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 29b:	8b 41 34             	mov    0x34(%ecx),%eax
+ 29e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 2a1:	8b 41 38             	mov    0x38(%ecx),%eax
+ 2a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    c = cpu[i];
+ 2a7:	89 c8                	mov    %ecx,%eax
+ 2a9:	89 4d 98             	mov    %ecx,-0x68(%ebp)
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b0:	89 d6                	mov    %edx,%esi
+    for(j = i; j > 0 && (cpu[j-1] < c ||
+ 2b2:	83 ea 01             	sub    $0x1,%edx
+ 2b5:	8b 0c 95 20 20 00 00 	mov    0x2020(,%edx,4),%ecx
+ 2bc:	39 f9                	cmp    %edi,%ecx
+ 2be:	7c 0f                	jl     2cf <show+0x11f>
+ 2c0:	0f 85 fa 01 00 00    	jne    4c0 <show+0x310>
+        (cpu[j-1] == c && new[j-1].rss < t.rss)); j--){
+ 2c6:	39 58 e8             	cmp    %ebx,-0x18(%eax)
+ 2c9:	0f 8d f1 01 00 00    	jge    4c0 <show+0x310>
+      new[j] = new[j-1];
+ 2cf:	8b 70 c4             	mov    -0x3c(%eax),%esi
+      cpu[j] = cpu[j-1];
+ 2d2:	89 0c 95 24 20 00 00 	mov    %ecx,0x2024(,%edx,4)
+    for(j = i; j > 0 && (cpu[j-1] < c ||
+ 2d9:	83 e8 3c             	sub    $0x3c,%eax
+      new[j] = new[j-1];
+ 2dc:	89 70 3c             	mov    %esi,0x3c(%eax)
+ 2df:	8b 70 04             	mov    0x4(%eax),%esi
+ 2e2:	89 70 40             	mov    %esi,0x40(%eax)
+ 2e5:	8b 70 08             	mov    0x8(%eax),%esi
+ 2e8:	89 70 44             	mov    %esi,0x44(%eax)
+ 2eb:	8b 70 0c             	mov    0xc(%eax),%esi
+ 2ee:	89 70 48             	mov    %esi,0x48(%eax)
+ 2f1:	8b 70 10             	mov    0x10(%eax),%esi
+ 2f4:	89 70 4c             	mov    %esi,0x4c(%eax)
+ 2f7:	8b 70 14             	mov    0x14(%eax),%esi
+ 2fa:	89 70 50             	mov    %esi,0x50(%eax)
+ 2fd:	8b 70 18             	mov    0x18(%eax),%esi
+ 300:	89 70 54             	mov    %esi,0x54(%eax)
+ 303:	8b 70 1c             	mov    0x1c(%eax),%esi
+ 306:	89 70 58             	mov    %esi,0x58(%eax)
+ 309:	8b 70 20             	mov    0x20(%eax),%esi
+ 30c:	89 70 5c             	mov    %esi,0x5c(%eax)
+ 30f:	8b 70 24             	mov    0x24(%eax),%esi
+ 312:	89 70 60             	mov    %esi,0x60(%eax)
+ 315:	8b 70 28             	mov    0x28(%eax),%esi
+ 318:	89 70 64             	mov    %esi,0x64(%eax)
+ 31b:	8b 70 2c             	mov    0x2c(%eax),%esi
+ 31e:	89 70 68             	mov    %esi,0x68(%eax)
+ 321:	8b 70 30             	mov    0x30(%eax),%esi
+ 324:	89 70 6c             	mov    %esi,0x6c(%eax)
+ 327:	8b 70 34             	mov    0x34(%eax),%esi
+ 32a:	89 70 70             	mov    %esi,0x70(%eax)
+ 32d:	8b 70 38             	mov    0x38(%eax),%esi
+ 330:	89 70 74             	mov    %esi,0x74(%eax)
+    for(j = i; j > 0 && (cpu[j-1] < c ||
+ 333:	85 d2                	test   %edx,%edx
+ 335:	0f 85 75 ff ff ff    	jne    2b0 <show+0x100>
+ 33b:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+ 33e:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+ 341:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+    new[j] = t;
+ 348:	6b 55 a4 3c          	imul   $0x3c,-0x5c(%ebp),%edx
+ 34c:	8b 75 ac             	mov    -0x54(%ebp),%esi
+  for(i = 1; i < nnew; i++){
+ 34f:	83 c3 01             	add    $0x1,%ebx
+ 352:	83 c1 3c             	add    $0x3c,%ecx
+    new[j] = t;
+ 355:	89 b2 20 21 00 00    	mov    %esi,0x2120(%edx)
+ 35b:	8d 82 20 21 00 00    	lea    0x2120(%edx),%eax
+ 361:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 364:	89 50 04             	mov    %edx,0x4(%eax)
+ 367:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 36a:	89 50 08             	mov    %edx,0x8(%eax)
+ 36d:	8b 55 b8             	mov    -0x48(%ebp),%edx
+ 370:	89 50 0c             	mov    %edx,0xc(%eax)
+ 373:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ 376:	89 50 10             	mov    %edx,0x10(%eax)
+ 379:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ 37c:	89 50 14             	mov    %edx,0x14(%eax)
+ 37f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 382:	89 50 18             	mov    %edx,0x18(%eax)
+ 385:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 388:	89 50 1c             	mov    %edx,0x1c(%eax)
+ 38b:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 38e:	89 50 20             	mov    %edx,0x20(%eax)
+ 391:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 394:	89 50 24             	mov    %edx,0x24(%eax)
+ 397:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 39a:	89 50 28             	mov    %edx,0x28(%eax)
+ 39d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 3a0:	89 50 2c             	mov    %edx,0x2c(%eax)
+ 3a3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 3a6:	89 50 30             	mov    %edx,0x30(%eax)
+ 3a9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 3ac:	89 50 34             	mov    %edx,0x34(%eax)
+ 3af:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 3b2:	89 50 38             	mov    %edx,0x38(%eax)
+    cpu[j] = c;
+ 3b5:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+ 3b8:	89 3c 85 20 20 00 00 	mov    %edi,0x2020(,%eax,4)
+  for(i = 1; i < nnew; i++){
+ 3bf:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 3c2:	39 c3                	cmp    %eax,%ebx
+ 3c4:	0f 85 76 fe ff ff    	jne    240 <show+0x90>
+  for(i = 0; i < nnew; i++){
+ 3ca:	6b 5d a0 3c          	imul   $0x3c,-0x60(%ebp),%ebx
+ 3ce:	b8 20 21 00 00       	mov    $0x2120,%eax
+  rss = shared = 0;
+ 3d3:	31 c9                	xor    %ecx,%ecx
+ 3d5:	31 d2                	xor    %edx,%edx
+ 3d7:	01 c3                	add    %eax,%ebx
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    rss += new[i].rss;
+ 3e0:	03 50 24             	add    0x24(%eax),%edx
+    shared += new[i].shared;
+ 3e3:	03 48 28             	add    0x28(%eax),%ecx
+  for(i = 0; i < nnew; i++){
+ 3e6:	83 c0 3c             	add    $0x3c,%eax
+ 3e9:	39 d8                	cmp    %ebx,%eax
+ 3eb:	75 f3                	jne    3e0 <show+0x230>
+  printf(1, "%d processes, %d resident pages, %d shared\n",
+ 3ed:	83 ec 0c             	sub    $0xc,%esp
+ 3f0:	be 28 21 00 00       	mov    $0x2128,%esi
+  for(i = 0; i < nnew; i++){
+ 3f5:	31 db                	xor    %ebx,%ebx
+  printf(1, "%d processes, %d resident pages, %d shared\n",
+ 3f7:	51                   	push   %ecx
+ 3f8:	52                   	push   %edx
+ 3f9:	ff 75 a0             	push   -0x60(%ebp)
+ 3fc:	68 00 10 00 00       	push   $0x1000
+ 401:	6a 01                	push   $0x1
+ 403:	e8 b8 04 00 00       	call   8c0 <printf>
+  printf(1, "pid\tppid\tstate\tcpu%%\tticks\trss\tshared\tprivate\twmap\tpgtbl\tname\n");
+ 408:	83 c4 18             	add    $0x18,%esp
+ 40b:	68 2c 10 00 00       	push   $0x102c
+ 410:	6a 01                	push   $0x1
+ 412:	e8 a9 04 00 00       	call   8c0 <printf>
+  for(i = 0; i < nnew; i++){
+ 417:	8b 0d 00 20 00 00    	mov    0x2000,%ecx
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	85 c9                	test   %ecx,%ecx
+ 422:	7e 76                	jle    49a <show+0x2ea>
+ 424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+ 428:	8b 46 28             	mov    0x28(%esi),%eax
+ 42b:	8b 55 08             	mov    0x8(%ebp),%edx
+           new[i].pgtable, new[i].name);
+ 42e:	8d 7e 08             	lea    0x8(%esi),%edi
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+ 431:	8b 4e 2c             	mov    0x2c(%esi),%ecx
+ 434:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+ 437:	8b 46 24             	mov    0x24(%esi),%eax
+ 43a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+ 43d:	8b 46 20             	mov    0x20(%esi),%eax
+ 440:	89 45 9c             	mov    %eax,-0x64(%ebp)
+ 443:	8b 46 1c             	mov    0x1c(%esi),%eax
+ 446:	89 45 98             	mov    %eax,-0x68(%ebp)
+ 449:	8b 46 30             	mov    0x30(%esi),%eax
+ 44c:	89 45 94             	mov    %eax,-0x6c(%ebp)
+ 44f:	31 c0                	xor    %eax,%eax
+ 451:	85 d2                	test   %edx,%edx
+ 453:	74 0c                	je     461 <show+0x2b1>
+           interval ? cpu[i]*100/interval : 0, new[i].ticks,
+ 455:	6b 04 9d 20 20 00 00 	imul   $0x64,0x2020(,%ebx,4),%eax
+ 45c:	64 
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+ 45d:	99                   	cltd
+ 45e:	f7 7d 08             	idivl  0x8(%ebp)
+ 461:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < nnew; i++){
+ 464:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+ 467:	57                   	push   %edi
+ 468:	51                   	push   %ecx
+ 469:	ff 75 a4             	push   -0x5c(%ebp)
+ 46c:	ff 75 a0             	push   -0x60(%ebp)
+ 46f:	ff 75 9c             	push   -0x64(%ebp)
+ 472:	ff 75 98             	push   -0x68(%ebp)
+ 475:	ff 75 94             	push   -0x6c(%ebp)
+ 478:	50                   	push   %eax
+ 479:	56                   	push   %esi
+  for(i = 0; i < nnew; i++){
+ 47a:	83 c6 3c             	add    $0x3c,%esi
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+ 47d:	ff 76 c0             	push   -0x40(%esi)
+ 480:	ff 76 bc             	push   -0x44(%esi)
+ 483:	68 6c 10 00 00       	push   $0x106c
+ 488:	6a 01                	push   $0x1
+ 48a:	e8 31 04 00 00       	call   8c0 <printf>
+  for(i = 0; i < nnew; i++){
+ 48f:	83 c4 40             	add    $0x40,%esp
+ 492:	39 1d 00 20 00 00    	cmp    %ebx,0x2000
+ 498:	7f 8e                	jg     428 <show+0x278>
+  printf(1, "\n");
+ 49a:	83 ec 08             	sub    $0x8,%esp
+ 49d:	68 d9 10 00 00       	push   $0x10d9
+ 4a2:	6a 01                	push   $0x1
+ 4a4:	e8 17 04 00 00       	call   8c0 <printf>
+}
+ 4a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ac:	5b                   	pop    %ebx
+ 4ad:	5e                   	pop    %esi
+ 4ae:	5f                   	pop    %edi
+ 4af:	5d                   	pop    %ebp
+ 4b0:	c3                   	ret
+ 4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return pi->ticks;
+ 4b8:	8b 07                	mov    (%edi),%eax
+ 4ba:	e9 4f fd ff ff       	jmp    20e <show+0x5e>
+ 4bf:	90                   	nop
+ 4c0:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+ 4c3:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+ 4c6:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+ 4c9:	e9 7a fe ff ff       	jmp    348 <show+0x198>
+  rss = shared = 0;
+ 4ce:	31 c9                	xor    %ecx,%ecx
+ 4d0:	31 d2                	xor    %edx,%edx
+ 4d2:	e9 16 ff ff ff       	jmp    3ed <show+0x23d>
+ 4d7:	66 90                	xchg   %ax,%ax
+ 4d9:	66 90                	xchg   %ax,%ax
+ 4db:	66 90                	xchg   %ax,%ax
+ 4dd:	66 90                	xchg   %ax,%ax
+ 4df:	90                   	nop
+
+000004e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 4e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 4e1:	31 c0                	xor    %eax,%eax
+{
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	53                   	push   %ebx
+ 4e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4f7:	83 c0 01             	add    $0x1,%eax
+ 4fa:	84 d2                	test   %dl,%dl
+ 4fc:	75 f2                	jne    4f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 4fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 501:	89 c8                	mov    %ecx,%eax
+ 503:	c9                   	leave
+ 504:	c3                   	ret
+ 505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+ 517:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 51a:	0f b6 02             	movzbl (%edx),%eax
+ 51d:	84 c0                	test   %al,%al
+ 51f:	75 17                	jne    538 <strcmp+0x28>
+ 521:	eb 3a                	jmp    55d <strcmp+0x4d>
+ 523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 527:	90                   	nop
+ 528:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 52c:	83 c2 01             	add    $0x1,%edx
+ 52f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 532:	84 c0                	test   %al,%al
+ 534:	74 1a                	je     550 <strcmp+0x40>
+    p++, q++;
+ 536:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 538:	0f b6 19             	movzbl (%ecx),%ebx
+ 53b:	38 c3                	cmp    %al,%bl
+ 53d:	74 e9                	je     528 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 53f:	29 d8                	sub    %ebx,%eax
+}
+ 541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 544:	c9                   	leave
+ 545:	c3                   	ret
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 550:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 554:	31 c0                	xor    %eax,%eax
+ 556:	29 d8                	sub    %ebx,%eax
+}
+ 558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 55b:	c9                   	leave
+ 55c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 55d:	0f b6 19             	movzbl (%ecx),%ebx
+ 560:	31 c0                	xor    %eax,%eax
+ 562:	eb db                	jmp    53f <strcmp+0x2f>
+ 564:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+
+00000570 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 576:	80 3a 00             	cmpb   $0x0,(%edx)
+ 579:	74 15                	je     590 <strlen+0x20>
+ 57b:	31 c0                	xor    %eax,%eax
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+ 580:	83 c0 01             	add    $0x1,%eax
+ 583:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 587:	89 c1                	mov    %eax,%ecx
+ 589:	75 f5                	jne    580 <strlen+0x10>
+    ;
+  return n;
+}
+ 58b:	89 c8                	mov    %ecx,%eax
+ 58d:	5d                   	pop    %ebp
+ 58e:	c3                   	ret
+ 58f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 590:	31 c9                	xor    %ecx,%ecx
+}
+ 592:	5d                   	pop    %ebp
+ 593:	89 c8                	mov    %ecx,%eax
+ 595:	c3                   	ret
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 5a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ad:	89 d7                	mov    %edx,%edi
+ 5af:	fc                   	cld
+ 5b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 5b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5b5:	89 d0                	mov    %edx,%eax
+ 5b7:	c9                   	leave
+ 5b8:	c3                   	ret
+ 5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5ca:	0f b6 10             	movzbl (%eax),%edx
+ 5cd:	84 d2                	test   %dl,%dl
+ 5cf:	75 12                	jne    5e3 <strchr+0x23>
+ 5d1:	eb 1d                	jmp    5f0 <strchr+0x30>
+ 5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5d7:	90                   	nop
+ 5d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5dc:	83 c0 01             	add    $0x1,%eax
+ 5df:	84 d2                	test   %dl,%dl
+ 5e1:	74 0d                	je     5f0 <strchr+0x30>
+    if(*s == c)
+ 5e3:	38 d1                	cmp    %dl,%cl
+ 5e5:	75 f1                	jne    5d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 5e7:	5d                   	pop    %ebp
+ 5e8:	c3                   	ret
+ 5e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5f0:	31 c0                	xor    %eax,%eax
+}
+ 5f2:	5d                   	pop    %ebp
+ 5f3:	c3                   	ret
+ 5f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+
+00000600 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 605:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 608:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 609:	31 db                	xor    %ebx,%ebx
+{
+ 60b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 60e:	eb 27                	jmp    637 <gets+0x37>
+    cc = read(0, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	6a 01                	push   $0x1
+ 615:	56                   	push   %esi
+ 616:	6a 00                	push   $0x0
+ 618:	e8 1e 01 00 00       	call   73b <read>
+    if(cc < 1)
+ 61d:	83 c4 10             	add    $0x10,%esp
+ 620:	85 c0                	test   %eax,%eax
+ 622:	7e 1d                	jle    641 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 624:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 628:	8b 55 08             	mov    0x8(%ebp),%edx
+ 62b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 62f:	3c 0a                	cmp    $0xa,%al
+ 631:	74 10                	je     643 <gets+0x43>
+ 633:	3c 0d                	cmp    $0xd,%al
+ 635:	74 0c                	je     643 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 637:	89 df                	mov    %ebx,%edi
+ 639:	83 c3 01             	add    $0x1,%ebx
+ 63c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 63f:	7c cf                	jl     610 <gets+0x10>
+ 641:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 64a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64d:	5b                   	pop    %ebx
+ 64e:	5e                   	pop    %esi
+ 64f:	5f                   	pop    %edi
+ 650:	5d                   	pop    %ebp
+ 651:	c3                   	ret
+ 652:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	56                   	push   %esi
+ 664:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 665:	83 ec 08             	sub    $0x8,%esp
+ 668:	6a 00                	push   $0x0
+ 66a:	ff 75 08             	push   0x8(%ebp)
+ 66d:	e8 f1 00 00 00       	call   763 <open>
+  if(fd < 0)
+ 672:	83 c4 10             	add    $0x10,%esp
+ 675:	85 c0                	test   %eax,%eax
+ 677:	78 27                	js     6a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 679:	83 ec 08             	sub    $0x8,%esp
+ 67c:	ff 75 0c             	push   0xc(%ebp)
+ 67f:	89 c3                	mov    %eax,%ebx
+ 681:	50                   	push   %eax
+ 682:	e8 f4 00 00 00       	call   77b <fstat>
+  close(fd);
+ 687:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 68a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 68c:	e8 ba 00 00 00       	call   74b <close>
+  return r;
+ 691:	83 c4 10             	add    $0x10,%esp
+}
+ 694:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 697:	89 f0                	mov    %esi,%eax
+ 699:	5b                   	pop    %ebx
+ 69a:	5e                   	pop    %esi
+ 69b:	5d                   	pop    %ebp
+ 69c:	c3                   	ret
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 6a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6a5:	eb ed                	jmp    694 <stat+0x34>
+ 6a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ae:	66 90                	xchg   %ax,%ax
+
+000006b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	53                   	push   %ebx
+ 6b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 6b7:	0f be 02             	movsbl (%edx),%eax
+ 6ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6c5:	77 1e                	ja     6e5 <atoi+0x35>
+ 6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6d0:	83 c2 01             	add    $0x1,%edx
+ 6d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6da:	0f be 02             	movsbl (%edx),%eax
+ 6dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 6e0:	80 fb 09             	cmp    $0x9,%bl
+ 6e3:	76 eb                	jbe    6d0 <atoi+0x20>
+  return n;
+}
+ 6e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6e8:	89 c8                	mov    %ecx,%eax
+ 6ea:	c9                   	leave
+ 6eb:	c3                   	ret
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6fe:	85 c0                	test   %eax,%eax
+ 700:	7e 13                	jle    715 <memmove+0x25>
+ 702:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 704:	89 d7                	mov    %edx,%edi
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 710:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 711:	39 f8                	cmp    %edi,%eax
+ 713:	75 fb                	jne    710 <memmove+0x20>
+  return vdst;
+}
+ 715:	5e                   	pop    %esi
+ 716:	89 d0                	mov    %edx,%eax
+ 718:	5f                   	pop    %edi
+ 719:	5d                   	pop    %ebp
+ 71a:	c3                   	ret
+
+0000071b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 71b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <exit>:
+SYSCALL(exit)
+ 723:	b8 02 00 00 00       	mov    $0x2,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <wait>:
+SYSCALL(wait)
+ 72b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <pipe>:
+SYSCALL(pipe)
+ 733:	b8 04 00 00 00       	mov    $0x4,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <read>:
+SYSCALL(read)
+ 73b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <write>:
+SYSCALL(write)
+ 743:	b8 10 00 00 00       	mov    $0x10,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <close>:
+SYSCALL(close)
+ 74b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <kill>:
+SYSCALL(kill)
+ 753:	b8 06 00 00 00       	mov    $0x6,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <exec>:
+SYSCALL(exec)
+ 75b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <open>:
+SYSCALL(open)
+ 763:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <mknod>:
+SYSCALL(mknod)
+ 76b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <unlink>:
+SYSCALL(unlink)
+ 773:	b8 12 00 00 00       	mov    $0x12,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <fstat>:
+SYSCALL(fstat)
+ 77b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <link>:
+SYSCALL(link)
+ 783:	b8 13 00 00 00       	mov    $0x13,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <mkdir>:
+SYSCALL(mkdir)
+ 78b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <chdir>:
+SYSCALL(chdir)
+ 793:	b8 09 00 00 00       	mov    $0x9,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <dup>:
+SYSCALL(dup)
+ 79b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <getpid>:
+SYSCALL(getpid)
+ 7a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <sbrk>:
+SYSCALL(sbrk)
+ 7ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <sleep>:
+SYSCALL(sleep)
+ 7b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <uptime>:
+SYSCALL(uptime)
+ 7bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <wmap>:
+SYSCALL(wmap)
+ 7c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <wunmap>:
+SYSCALL(wunmap)
+ 7cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <va2pa>:
+SYSCALL(va2pa)
+ 7d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 7db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <getwssinfo>:
+SYSCALL(getwssinfo)
+ 7e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <setmergeable>:
+SYSCALL(setmergeable)
+ 7eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <getvmstat>:
+SYSCALL(getvmstat)
+ 7f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <getfaulthist>:
+SYSCALL(getfaulthist)
+ 7fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <getprocinfo>:
+SYSCALL(getprocinfo)
+ 803:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <spawn>:
+SYSCALL(spawn)
+ 80b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <fsync>:
+SYSCALL(fsync)
+ 813:	b8 20 00 00 00       	mov    $0x20,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+ 81b:	66 90                	xchg   %ax,%ax
+ 81d:	66 90                	xchg   %ax,%ax
+ 81f:	90                   	nop
+
+00000820 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 828:	89 d1                	mov    %edx,%ecx
+{
+ 82a:	83 ec 3c             	sub    $0x3c,%esp
+ 82d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 830:	85 d2                	test   %edx,%edx
+ 832:	0f 89 80 00 00 00    	jns    8b8 <printint+0x98>
+ 838:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 83c:	74 7a                	je     8b8 <printint+0x98>
+    x = -xx;
+ 83e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 840:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 845:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 848:	31 f6                	xor    %esi,%esi
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 850:	89 c8                	mov    %ecx,%eax
+ 852:	31 d2                	xor    %edx,%edx
+ 854:	89 f7                	mov    %esi,%edi
+ 856:	f7 f3                	div    %ebx
+ 858:	8d 76 01             	lea    0x1(%esi),%esi
+ 85b:	0f b6 92 3c 11 00 00 	movzbl 0x113c(%edx),%edx
+ 862:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 866:	89 ca                	mov    %ecx,%edx
+ 868:	89 c1                	mov    %eax,%ecx
+ 86a:	39 da                	cmp    %ebx,%edx
+ 86c:	73 e2                	jae    850 <printint+0x30>
+  if(neg)
+ 86e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 871:	85 c0                	test   %eax,%eax
+ 873:	74 07                	je     87c <printint+0x5c>
+    buf[i++] = '-';
+ 875:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 87a:	89 f7                	mov    %esi,%edi
+ 87c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 87f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 882:	01 df                	add    %ebx,%edi
+ 884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 888:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 88b:	83 ec 04             	sub    $0x4,%esp
+ 88e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 891:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 894:	6a 01                	push   $0x1
+ 896:	50                   	push   %eax
+ 897:	56                   	push   %esi
+ 898:	e8 a6 fe ff ff       	call   743 <write>
+  while(--i >= 0)
+ 89d:	89 f8                	mov    %edi,%eax
+ 89f:	83 c4 10             	add    $0x10,%esp
+ 8a2:	83 ef 01             	sub    $0x1,%edi
+ 8a5:	39 d8                	cmp    %ebx,%eax
+ 8a7:	75 df                	jne    888 <printint+0x68>
+}
+ 8a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ac:	5b                   	pop    %ebx
+ 8ad:	5e                   	pop    %esi
+ 8ae:	5f                   	pop    %edi
+ 8af:	5d                   	pop    %ebp
+ 8b0:	c3                   	ret
+ 8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8b8:	31 c0                	xor    %eax,%eax
+ 8ba:	eb 89                	jmp    845 <printint+0x25>
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8d2:	83 c6 01             	add    $0x1,%esi
+ 8d5:	84 db                	test   %bl,%bl
+ 8d7:	74 67                	je     940 <printf+0x80>
+ 8d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8dc:	31 d2                	xor    %edx,%edx
+ 8de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8e1:	eb 34                	jmp    917 <printf+0x57>
+ 8e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8e7:	90                   	nop
+ 8e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8f0:	83 f8 25             	cmp    $0x25,%eax
+ 8f3:	74 18                	je     90d <printf+0x4d>
+  write(fd, &c, 1);
+ 8f5:	83 ec 04             	sub    $0x4,%esp
+ 8f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8fe:	6a 01                	push   $0x1
+ 900:	50                   	push   %eax
+ 901:	57                   	push   %edi
+ 902:	e8 3c fe ff ff       	call   743 <write>
+ 907:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 90a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 90d:	0f b6 1e             	movzbl (%esi),%ebx
+ 910:	83 c6 01             	add    $0x1,%esi
+ 913:	84 db                	test   %bl,%bl
+ 915:	74 29                	je     940 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 917:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 91a:	85 d2                	test   %edx,%edx
+ 91c:	74 ca                	je     8e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 91e:	83 fa 25             	cmp    $0x25,%edx
+ 921:	75 ea                	jne    90d <printf+0x4d>
+      if(c == 'd'){
+ 923:	83 f8 25             	cmp    $0x25,%eax
+ 926:	0f 84 24 01 00 00    	je     a50 <printf+0x190>
+ 92c:	83 e8 63             	sub    $0x63,%eax
+ 92f:	83 f8 15             	cmp    $0x15,%eax
+ 932:	77 1c                	ja     950 <printf+0x90>
+ 934:	ff 24 85 e4 10 00 00 	jmp    *0x10e4(,%eax,4)
+ 93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 943:	5b                   	pop    %ebx
+ 944:	5e                   	pop    %esi
+ 945:	5f                   	pop    %edi
+ 946:	5d                   	pop    %ebp
+ 947:	c3                   	ret
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 956:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 95a:	6a 01                	push   $0x1
+ 95c:	52                   	push   %edx
+ 95d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 960:	57                   	push   %edi
+ 961:	e8 dd fd ff ff       	call   743 <write>
+ 966:	83 c4 0c             	add    $0xc,%esp
+ 969:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 96c:	6a 01                	push   $0x1
+ 96e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 971:	52                   	push   %edx
+ 972:	57                   	push   %edi
+ 973:	e8 cb fd ff ff       	call   743 <write>
+        putc(fd, c);
+ 978:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 97b:	31 d2                	xor    %edx,%edx
+ 97d:	eb 8e                	jmp    90d <printf+0x4d>
+ 97f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 980:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 98b:	8b 13                	mov    (%ebx),%edx
+ 98d:	6a 00                	push   $0x0
+ 98f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 991:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 994:	e8 87 fe ff ff       	call   820 <printint>
+        ap++;
+ 999:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 99c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 99f:	31 d2                	xor    %edx,%edx
+ 9a1:	e9 67 ff ff ff       	jmp    90d <printf+0x4d>
+ 9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9b5:	83 c0 04             	add    $0x4,%eax
+ 9b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9bb:	85 db                	test   %ebx,%ebx
+ 9bd:	0f 84 9d 00 00 00    	je     a60 <printf+0x1a0>
+        while(*s != 0){
+ 9c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9c8:	84 c0                	test   %al,%al
+ 9ca:	0f 84 3d ff ff ff    	je     90d <printf+0x4d>
+ 9d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9d6:	89 de                	mov    %ebx,%esi
+ 9d8:	89 d3                	mov    %edx,%ebx
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	53                   	push   %ebx
+ 9ec:	57                   	push   %edi
+ 9ed:	e8 51 fd ff ff       	call   743 <write>
+        while(*s != 0){
+ 9f2:	0f b6 06             	movzbl (%esi),%eax
+ 9f5:	83 c4 10             	add    $0x10,%esp
+ 9f8:	84 c0                	test   %al,%al
+ 9fa:	75 e4                	jne    9e0 <printf+0x120>
+      state = 0;
+ 9fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 07 ff ff ff       	jmp    90d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a1b:	8b 13                	mov    (%ebx),%edx
+ a1d:	6a 01                	push   $0x1
+ a1f:	e9 6b ff ff ff       	jmp    98f <printf+0xcf>
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a28:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a2b:	83 ec 04             	sub    $0x4,%esp
+ a2e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a31:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a33:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a36:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a39:	6a 01                	push   $0x1
+ a3b:	52                   	push   %edx
+ a3c:	57                   	push   %edi
+ a3d:	e8 01 fd ff ff       	call   743 <write>
+        ap++;
+ a42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a45:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a48:	31 d2                	xor    %edx,%edx
+ a4a:	e9 be fe ff ff       	jmp    90d <printf+0x4d>
+ a4f:	90                   	nop
+  write(fd, &c, 1);
+ a50:	83 ec 04             	sub    $0x4,%esp
+ a53:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a56:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a59:	6a 01                	push   $0x1
+ a5b:	e9 11 ff ff ff       	jmp    971 <printf+0xb1>
+ a60:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a65:	bb db 10 00 00       	mov    $0x10db,%ebx
+ a6a:	e9 61 ff ff ff       	jmp    9d0 <printf+0x110>
+ a6f:	90                   	nop
+
+00000a70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a71:	a1 20 3f 00 00       	mov    0x3f20,%eax
+{
+ a76:	89 e5                	mov    %esp,%ebp
+ a78:	57                   	push   %edi
+ a79:	56                   	push   %esi
+ a7a:	53                   	push   %ebx
+ a7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a8c:	39 ca                	cmp    %ecx,%edx
+ a8e:	73 30                	jae    ac0 <free+0x50>
+ a90:	39 c1                	cmp    %eax,%ecx
+ a92:	72 04                	jb     a98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a94:	39 c2                	cmp    %eax,%edx
+ a96:	72 f0                	jb     a88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a9e:	39 f8                	cmp    %edi,%eax
+ aa0:	74 2e                	je     ad0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aa2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ aa5:	8b 42 04             	mov    0x4(%edx),%eax
+ aa8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aab:	39 f1                	cmp    %esi,%ecx
+ aad:	74 38                	je     ae7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ aaf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ab1:	5b                   	pop    %ebx
+  freep = p;
+ ab2:	89 15 20 3f 00 00    	mov    %edx,0x3f20
+}
+ ab8:	5e                   	pop    %esi
+ ab9:	5f                   	pop    %edi
+ aba:	5d                   	pop    %ebp
+ abb:	c3                   	ret
+ abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ac0:	39 c1                	cmp    %eax,%ecx
+ ac2:	72 d0                	jb     a94 <free+0x24>
+ ac4:	eb c2                	jmp    a88 <free+0x18>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ad0:	03 70 04             	add    0x4(%eax),%esi
+ ad3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ad6:	8b 02                	mov    (%edx),%eax
+ ad8:	8b 00                	mov    (%eax),%eax
+ ada:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ add:	8b 42 04             	mov    0x4(%edx),%eax
+ ae0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ae3:	39 f1                	cmp    %esi,%ecx
+ ae5:	75 c8                	jne    aaf <free+0x3f>
+    p->s.size += bp->s.size;
+ ae7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aea:	89 15 20 3f 00 00    	mov    %edx,0x3f20
+    p->s.size += bp->s.size;
+ af0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ af3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ af6:	89 0a                	mov    %ecx,(%edx)
+}
+ af8:	5b                   	pop    %ebx
+ af9:	5e                   	pop    %esi
+ afa:	5f                   	pop    %edi
+ afb:	5d                   	pop    %ebp
+ afc:	c3                   	ret
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b0c:	8b 15 20 3f 00 00    	mov    0x3f20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b12:	8d 78 07             	lea    0x7(%eax),%edi
+ b15:	c1 ef 03             	shr    $0x3,%edi
+ b18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b1b:	85 d2                	test   %edx,%edx
+ b1d:	0f 84 8d 00 00 00    	je     bb0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b25:	8b 48 04             	mov    0x4(%eax),%ecx
+ b28:	39 f9                	cmp    %edi,%ecx
+ b2a:	73 64                	jae    b90 <malloc+0x90>
+  if(nu < 4096)
+ b2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b31:	39 df                	cmp    %ebx,%edi
+ b33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b3d:	eb 0a                	jmp    b49 <malloc+0x49>
+ b3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b42:	8b 48 04             	mov    0x4(%eax),%ecx
+ b45:	39 f9                	cmp    %edi,%ecx
+ b47:	73 47                	jae    b90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b49:	89 c2                	mov    %eax,%edx
+ b4b:	39 05 20 3f 00 00    	cmp    %eax,0x3f20
+ b51:	75 ed                	jne    b40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b53:	83 ec 0c             	sub    $0xc,%esp
+ b56:	56                   	push   %esi
+ b57:	e8 4f fc ff ff       	call   7ab <sbrk>
+  if(p == (char*)-1)
+ b5c:	83 c4 10             	add    $0x10,%esp
+ b5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b62:	74 1c                	je     b80 <malloc+0x80>
+  hp->s.size = nu;
+ b64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b67:	83 ec 0c             	sub    $0xc,%esp
+ b6a:	83 c0 08             	add    $0x8,%eax
+ b6d:	50                   	push   %eax
+ b6e:	e8 fd fe ff ff       	call   a70 <free>
+  return freep;
+ b73:	8b 15 20 3f 00 00    	mov    0x3f20,%edx
+      if((p = morecore(nunits)) == 0)
+ b79:	83 c4 10             	add    $0x10,%esp
+ b7c:	85 d2                	test   %edx,%edx
+ b7e:	75 c0                	jne    b40 <malloc+0x40>
+        return 0;
+  }
+}
+ b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b83:	31 c0                	xor    %eax,%eax
+}
+ b85:	5b                   	pop    %ebx
+ b86:	5e                   	pop    %esi
+ b87:	5f                   	pop    %edi
+ b88:	5d                   	pop    %ebp
+ b89:	c3                   	ret
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b90:	39 cf                	cmp    %ecx,%edi
+ b92:	74 4c                	je     be0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b94:	29 f9                	sub    %edi,%ecx
+ b96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b9f:	89 15 20 3f 00 00    	mov    %edx,0x3f20
+}
+ ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ba8:	83 c0 08             	add    $0x8,%eax
+}
+ bab:	5b                   	pop    %ebx
+ bac:	5e                   	pop    %esi
+ bad:	5f                   	pop    %edi
+ bae:	5d                   	pop    %ebp
+ baf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ bb0:	c7 05 20 3f 00 00 24 	movl   $0x3f24,0x3f20
+ bb7:	3f 00 00 
+    base.s.size = 0;
+ bba:	b8 24 3f 00 00       	mov    $0x3f24,%eax
+    base.s.ptr = freep = prevp = &base;
+ bbf:	c7 05 24 3f 00 00 24 	movl   $0x3f24,0x3f24
+ bc6:	3f 00 00 
+    base.s.size = 0;
+ bc9:	c7 05 28 3f 00 00 00 	movl   $0x0,0x3f28
+ bd0:	00 00 00 
+    if(p->s.size >= nunits){
+ bd3:	e9 54 ff ff ff       	jmp    b2c <malloc+0x2c>
+ bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ be0:	8b 08                	mov    (%eax),%ecx
+ be2:	89 0a                	mov    %ecx,(%edx)
+ be4:	eb b9                	jmp    b9f <malloc+0x9f>
@@ -0,0 +1,95 @@
+// Show processes with their memory use and CPU time, busiest
+// first: every interval ticks (default 100), count times
+// (forever if count is 0 or missing). Memory is in pages; cpu
+// is the percentage of the interval spent running.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "wmap.h"
+
+struct procinfo old[NPROC], new[NPROC];
+int cpu[NPROC];
+int nold, nnew;
+
+// Ticks pi ran during the interval, or all of them if it is new.
+int
+ran(struct procinfo *pi)
+{
+  int i;
+
+  for(i = 0; i < nold; i++)
+    if(old[i].pid == pi->pid)
+      return pi->ticks - old[i].ticks;
+  return pi->ticks;
+}
+
+void
+show(int interval)
+{
+  struct procinfo t;
+  int i, j, c, rss, shared;
+
+  for(i = 0; i < nnew; i++)
+    cpu[i] = ran(&new[i]);
+  // Insertion sort by CPU time, then RSS.
+  for(i = 1; i < nnew; i++){
+    t = new[i];
+    c = cpu[i];
+    for(j = i; j > 0 && (cpu[j-1] < c ||
+        (cpu[j-1] == c && new[j-1].rss < t.rss)); j--){
+      new[j] = new[j-1];
+      cpu[j] = cpu[j-1];
+    }
+    new[j] = t;
+    cpu[j] = c;
+  }
+
+  rss = shared = 0;
+  for(i = 0; i < nnew; i++){
+    rss += new[i].rss;
+    shared += new[i].shared;
+  }
+  printf(1, "%d processes, %d resident pages, %d shared\n",
+         nnew, rss, shared);
+  printf(1, "pid\tppid\tstate\tcpu%%\tticks\trss\tshared\tprivate\twmap\tpgtbl\tname\n");
+  for(i = 0; i < nnew; i++){
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+           new[i].pid, new[i].ppid, new[i].state,
+           interval ? cpu[i]*100/interval : 0, new[i].ticks,
+           new[i].rss, new[i].shared, new[i].private, new[i].wmap,
+           new[i].pgtable, new[i].name);
+  }
+  printf(1, "\n");
+}
+
+int
+main(int argc, char **argv)
+{
+  int n, interval, count;
+
+  if(argc > 3){
+    printf(2, "usage: top [interval [count]]\n");
+    exit();
+  }
+  interval = argc > 1 ? atoi(argv[1]) : 100;
+  count = argc > 2 ? atoi(argv[2]) : 0;
+  if(interval <= 0){
+    printf(2, "top: bad interval\n");
+    exit();
+  }
+
+  nnew = getprocinfo(new, NPROC);
+  for(n = 0; count == 0 || n < count; n++){
+    memmove(old, new, sizeof(new));
+    nold = nnew;
+    sleep(interval);
+    if((nnew = getprocinfo(new, NPROC)) < 0){
+      printf(2, "top: getprocinfo failed\n");
+      exit();
+    }
+    show(interval);
+  }
+  exit();
+}
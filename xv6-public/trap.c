@@ -61,7 +61,11 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      if(ticks % WSSPERIOD == 0)
+        wssscan();
     }
+    if(myproc() && myproc()->state == RUNNING)
+      myproc()->cputicks++;
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -90,9 +94,22 @@ trap(struct trapframe *tf)
     struct proc *p = myproc();
     pde_t *pgdir = p->pgdir;
     pte_t *pte = walkpgdir(pgdir, (void*)c_addr, 0);
-    uint pa = PTE_ADDR(*pte);
     struct mmap *p_mmaps = p->mmaps;
 
+    uint t0 = rdtsc();
+    int fclass = -1;
+
+    vmcount(VM_FAULT, 1);
+    if (pte && SWAPPED(*pte)) {
+      if (swapin(pgdir, c_addr) < 0)
+        p->killed = 1;
+      else
+        faulttime(FAULT_SWAPIN, rdtsc() - t0);
+      lapiceoi();
+      break;
+    }
+    uint pa = pte ? PTE_ADDR(*pte) : 0;
+
     if (pte && pagerefs[PFN(pa)] == 0) {
       pte = 0;
     }
@@ -102,11 +119,16 @@ trap(struct trapframe *tf)
       if (*pte & PTE_OW) {
           if (pagerefs[PFN(pa)] == 1) {
             *pte |= PTE_W;
+            vmcount(VM_COWREUSE, 1);
           }
           // copy on write
           else {
-            char *mem = kalloc();
+            char *mem = kalloc_reclaim(0);
             if (mem == 0) p->killed = 1;
+            else if (PTE_ADDR(*pte) != pa || !(*pte & PTE_P)) {
+              // swapped out while reclaiming; fault again
+              kfree(mem);
+            }
             else {
               memmove(mem, (char*)P2V(pa), PGSIZE);
 	      *pte = 0;
@@ -116,6 +138,8 @@ trap(struct trapframe *tf)
               }
               else {
                 pagerefs[PFN(pa)]--;
+                vmcount(VM_COWCOPY, 1);
+                fclass = FAULT_COW;
               }
             }
           }
@@ -123,6 +147,7 @@ trap(struct trapframe *tf)
       }
       else {
         cprintf("Segmentation Fault\n");
+        vmcount(VM_SEGV, 1);
         p->killed = 1;
       }
     }
@@ -134,15 +159,22 @@ trap(struct trapframe *tf)
         int length = p_mmaps[i].length;
         struct file *file = p_mmaps[i].file;
         if (addr <= c_addr && c_addr < addr + length) {
-          char *mem = kalloc();
+          char *mem = 0;
+          // Map the page cache's frame, so the mapping and
+          // read()/write() see the same data. Writes to a
+          // read-only file stay in a private copy.
+          if (file != 0 && file->writable)
+            mem = filepage(file, c_addr - addr);
           if (mem == 0) {
-            p->killed = 1;
-            break;
-          }
-          memset(mem, 0, PGSIZE);
-          if (file != 0) {
-            file->off = c_addr - addr;
-            fileread(file, mem, PGSIZE);
+            mem = kalloc_reclaim(1);
+            if (mem == 0) {
+              p->killed = 1;
+              break;
+            }
+            if (file != 0) {
+              file->off = c_addr - addr;
+              fileread(file, mem, PGSIZE);
+            }
           }
           if (mappages(pgdir, (void*)(c_addr), PGSIZE, V2P(mem), PTE_W | PTE_U) < 0) {
             kfree(mem);
@@ -150,14 +182,19 @@ trap(struct trapframe *tf)
             break;
           }
           p_mmaps[i].nloaded++;
+          vmcount(file != 0 ? VM_LAZYFILE : VM_LAZYANON, 1);
+          fclass = file != 0 ? FAULT_FILE : FAULT_ANON;
           break;
         }
       }
       if (i >= MAX_WMMAP_INFO) {
         cprintf("Segmentation Fault\n");
+        vmcount(VM_SEGV, 1);
         p->killed = 1;
       }
     }
+    if (fclass >= 0)
+      faulttime(fclass, rdtsc() - t0);
     lapiceoi();
     break;
 
@@ -186,8 +223,13 @@ trap(struct trapframe *tf)
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER){
+    // Holds no locks if interrupted in user mode, so the
+    // swapper may take its pages until it runs again.
+    myproc()->preempted = (tf->cs&3) == DPL_USER;
     yield();
+    myproc()->preempted = 0;
+  }
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
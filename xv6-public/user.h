@@ -1,6 +1,10 @@
 struct stat;
 struct rtcdate;
 struct wmapinfo;
+struct wssinfo;
+struct vmstat;
+struct faulthist;
+struct procinfo;
 
 // system calls
 int fork(void);
@@ -28,6 +32,13 @@ uint wmap(uint addr, int length, int flags, int fd);
 int wunmap(uint addr);
 uint va2pa(uint va);
 int getwmapinfo(struct wmapinfo *wminfo);
+int getwssinfo(int pid, struct wssinfo *wsinfo);
+int setmergeable(int on);
+int getvmstat(struct vmstat *vs, int size);
+int getfaulthist(struct faulthist *fh, int reset);
+int getprocinfo(struct procinfo *pi, int n);
+int spawn(char*, char**, int*, int);
+int fsync(int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -8,6 +8,8 @@
 #include "elf.h"
 #include "stdint.h"
 
+#define UVMBATCH 16  // pages per kalloc_bulk/kfree_bulk call
+
 extern unsigned char pagerefs[NPAGES];
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -44,10 +46,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -123,9 +124,8 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -188,24 +188,29 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
 // Load a program segment into pgdir.  addr must be page-aligned
 // and the pages from addr to addr+sz must already be mapped.
+// Pages of a read-only segment are mapped from the page cache
+// (pagecache.c) when they can be, and so shared with every other
+// process running the same program.
 int
 loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz, int flags)
 {
-  uint i, pa, n;
+  uint i, pa, n, z;
   pte_t *pte;
+  char *mem;
+  int share;
 
   int perm = PTE_P | PTE_U;
   if (flags & ELF_PROG_FLAG_WRITE) {
       perm |= PTE_W;
   }
+  share = !(flags & ELF_PROG_FLAG_WRITE) && offset % PGSIZE == 0;
 
   if((uint) addr % PGSIZE != 0)
     panic("loaduvm: addr must be page aligned");
@@ -213,11 +218,22 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz, int fl
     if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
       panic("loaduvm: address should exist");
     pa = PTE_ADDR(*pte);
-    *pte = pa | perm;
     if(sz - i < PGSIZE)
       n = sz - i;
     else
       n = PGSIZE;
+    if(share && (mem = pcacheget(ip, (offset+i)/PGSIZE, 1)) != 0){
+      // Usable if the file page has nothing past the segment.
+      for(z = PGSIZE; z > n && mem[z-1] == 0; z--)
+        ;
+      if(z <= n){
+        *pte = V2P(mem) | perm;
+        kfree(P2V(pa));
+        continue;
+      }
+      kfree(mem);
+    }
+    *pte = pa | perm;
     if(readi(ip, P2V(pa), offset+i, n) != n)
       return -1;
   }
@@ -226,11 +242,13 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz, int fl
 
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
+// Pages are taken from the allocator UVMBATCH at a time.
 int
 allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
-  char *mem;
+  char *mem[UVMBATCH];
   uint a;
+  int i, n, got;
 
   if(newsz >= KERNBASE)
     return 0;
@@ -238,21 +256,29 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     return oldsz;
 
   a = PGROUNDUP(oldsz);
-  for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
-    if(mem == 0){
+  while(a < newsz){
+    n = (PGROUNDUP(newsz) - a) / PGSIZE;
+    if(n > UVMBATCH)
+      n = UVMBATCH;
+    got = kalloc_zeroed_bulk(mem, n);
+    while(got < n && reclaim(n - got, 1) > 0)
+      got += kalloc_zeroed_bulk(mem + got, n - got);
+    if(got < n){
       cprintf("allocuvm out of memory\n");
+      kfree_bulk(mem, got);
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
-    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
-      cprintf("allocuvm out of memory (2)\n");
-      deallocuvm(pgdir, newsz, oldsz);
-      kfree(mem);
-      return 0;
+    for(i = 0; i < n; i++, a += PGSIZE){
+      if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem[i]), PTE_W|PTE_U) < 0){
+        cprintf("allocuvm out of memory (2)\n");
+        kfree_bulk(mem + i, n - i);
+        deallocuvm(pgdir, newsz, oldsz);
+        return 0;
+      }
     }
   }
+  reclaimlow();
   return newsz;
 }
 
@@ -263,46 +289,87 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
+  char *batch[UVMBATCH];
   pte_t *pte;
   uint a, pa;
+  int n;
 
   if(newsz >= oldsz)
     return oldsz;
 
+  n = 0;
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
+    else if(SWAPPED(*pte)){
+      swapfree(SWAPSLOT(*pte));
+      *pte = 0;
+    } else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
-      char *v = P2V(pa);
-      kfree(v);
+      batch[n++] = P2V(pa);
+      if(n == UVMBATCH){
+        kfree_bulk(batch, n);
+        n = 0;
+      }
       *pte = 0;
     }
   }
+  kfree_bulk(batch, n);
   return newsz;
 }
 
+// Count the present pages in [start, end) of pgdir, and in
+// *shared (if not 0) those whose frame is also mapped elsewhere.
+int
+residentuvm(pde_t *pgdir, uint start, uint end, int *shared)
+{
+  pte_t *pte;
+  uint a;
+  int n;
+
+  n = 0;
+  for(a = PGROUNDDOWN(start); a < end; a += PGSIZE){
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(!(*pte & PTE_P))
+      continue;
+    n++;
+    if(shared && pagerefs[PFN(PTE_ADDR(*pte))] > 1)
+      (*shared)++;
+  }
+  return n;
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
 freevm(pde_t *pgdir)
 {
+  char *batch[UVMBATCH];
   uint i;
+  int n;
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
+  n = 0;
   for(i = 0; i < NPDENTRIES; i++){
     if(pgdir[i] & PTE_P){
-      char * v = P2V(PTE_ADDR(pgdir[i]));
-      kfree(v);
+      batch[n++] = P2V(PTE_ADDR(pgdir[i]));
+      if(n == UVMBATCH){
+        kfree_bulk(batch, n);
+        n = 0;
+      }
     }
   }
-  kfree((char*)pgdir);
+  batch[n++] = (char*)pgdir;
+  kfree_bulk(batch, n);
 }
 
 // Clear PTE_U on a page. Used to create an inaccessible
@@ -324,7 +391,7 @@ pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
-  pte_t *pte;
+  pte_t *pte, *dpte;
   uint pa, i, flags;
 
   if((d = setupkvm()) == 0)
@@ -332,6 +399,14 @@ copyuvm(pde_t *pgdir, uint sz)
   for(i = 0; i < sz; i += PGSIZE){
     if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
       panic("copyuvm: pte should exist");
+    if(SWAPPED(*pte)){
+      // child gets its own reference to the swap slot
+      if((dpte = walkpgdir(d, (void *) i, 1)) == 0)
+        goto bad;
+      swapdup(SWAPSLOT(*pte));
+      *dpte = *pte;
+      continue;
+    }
     if(!(*pte & PTE_P))
       panic("copyuvm: page not present");
 
@@ -343,6 +418,7 @@ copyuvm(pde_t *pgdir, uint sz)
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
     pagerefs[PFN(pa)]++;
+    vmcount(VM_COPYUVM, 1);
     if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0) {
       kfree(P2V(pa));
       goto bad;
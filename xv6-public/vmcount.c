@@ -0,0 +1,118 @@
+// Virtual memory statistics.
+//
+// Event counters are per CPU (struct cpu's vmevent[]), so the
+// fault and allocation paths can bump them without sharing a
+// cache line or taking a lock; getvmstat() sums them. The other
+// figures are gauges computed when asked.
+//
+// Page fault latencies, measured with the TSC, are kept the same
+// way in per-CPU histograms with power-of-two buckets.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+
+extern unsigned char pagerefs[NPAGES];
+
+// Count n events of kind which on this CPU.
+void
+vmcount(int which, int n)
+{
+  pushcli();
+  mycpu()->vmevent[which] += n;
+  popcli();
+}
+
+// Count the user PTEs in pgdir that map a page copy-on-write
+// while something else still holds it. Page cache references
+// also raise pagerefs[], so look at PTE_OW rather than at the
+// reference counts alone.
+static uint
+cowmappings(pde_t *pgdir)
+{
+  pte_t *pt;
+  uint i, j, n;
+
+  n = 0;
+  for(i = 0; i < PDX(KERNBASE); i++){
+    if(!(pgdir[i] & PTE_P))
+      continue;
+    pt = (pte_t*)P2V(PTE_ADDR(pgdir[i]));
+    for(j = 0; j < NPTENTRIES; j++)
+      if((pt[j] & (PTE_P|PTE_W|PTE_OW)) == (PTE_P|PTE_OW) &&
+         pagerefs[PFN(PTE_ADDR(pt[j]))] > 1)
+        n++;
+  }
+  return n;
+}
+
+// Fill in a snapshot of the statistics.
+void
+getvmstat(struct vmstat *vs)
+{
+  struct proc *p;
+  struct mmap *m;
+  uint i;
+  int c;
+
+  memset(vs, 0, sizeof(*vs));
+  vs->version = VMSTAT_VERSION;
+  vs->size = sizeof(*vs);
+  vs->ticks = ticks;
+  vs->free = kfreecount();
+
+  lockptable();
+  for(c = 0; c < NPROC; c++){
+    p = procslot(c);
+    if(p->pgdir == 0 || p->state == UNUSED)
+      continue;
+    for(m = p->mmaps; m < &p->mmaps[MAX_WMMAP_INFO]; m++)
+      if(m->addr != -1)
+        vs->wmap += m->nloaded;
+    vs->pgtable++;
+    for(i = 0; i < NPDENTRIES; i++)
+      if(p->pgdir[i] & PTE_P)
+        vs->pgtable++;
+    vs->cowshared += cowmappings(p->pgdir);
+  }
+  unlockptable();
+
+  for(c = 0; c < ncpu; c++)
+    for(i = 0; i < NVMEVENT; i++)
+      vs->event[i] += cpus[c].vmevent[i];
+}
+
+// Record a fault of the given class that took cycles.
+void
+faulttime(int class, uint cycles)
+{
+  int b;
+
+  for(b = 0; b < NFAULTBUCKET-1 && (cycles >> (b+1)) != 0; b++)
+    ;
+  pushcli();
+  mycpu()->faulthist[class][b]++;
+  popcli();
+}
+
+// Sum the fault latency histograms of all CPUs into fh, and
+// clear them if reset is set. Faults recorded on other CPUs
+// while clearing may be lost.
+void
+getfaulthist(struct faulthist *fh, int reset)
+{
+  int c, i, b;
+
+  memset(fh, 0, sizeof(*fh));
+  for(c = 0; c < ncpu; c++){
+    for(i = 0; i < NFAULTCLASS; i++)
+      for(b = 0; b < NFAULTBUCKET; b++)
+        fh->count[i][b] += cpus[c].faulthist[i][b];
+    if(reset)
+      memset(cpus[c].faulthist, 0, sizeof(cpus[c].faulthist));
+  }
+}
@@ -0,0 +1,1388 @@
+
+_vmstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  17:	8b 39                	mov    (%ecx),%edi
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  struct vmstat old, new;
+  int i, interval, count, n;
+
+  if(argc > 3){
+  1c:	83 ff 03             	cmp    $0x3,%edi
+  1f:	7e 13                	jle    34 <main+0x34>
+    printf(2, "usage: vmstat [interval [count]]\n");
+  21:	50                   	push   %eax
+  22:	50                   	push   %eax
+  23:	68 b0 10 00 00       	push   $0x10b0
+  28:	6a 02                	push   $0x2
+  2a:	e8 01 06 00 00       	call   630 <printf>
+    exit();
+  2f:	e8 5f 04 00 00       	call   493 <exit>
+  }
+  snapshot(&new);
+  34:	83 ec 0c             	sub    $0xc,%esp
+  37:	8d 75 98             	lea    -0x68(%ebp),%esi
+  3a:	56                   	push   %esi
+  3b:	e8 d0 01 00 00       	call   210 <snapshot>
+  if(argc < 2){
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	83 ff 01             	cmp    $0x1,%edi
+  46:	0f 8e 4f 01 00 00    	jle    19b <main+0x19b>
+    for(i = 0; i < NVMEVENT; i++)
+      printf(1, "%s %d\n", names[i], new.event[i]);
+    exit();
+  }
+
+  interval = atoi(argv[1]);
+  4c:	83 ec 0c             	sub    $0xc,%esp
+  4f:	ff 73 04             	push   0x4(%ebx)
+  52:	e8 c9 03 00 00       	call   420 <atoi>
+  count = argc > 2 ? atoi(argv[2]) : 0;
+  57:	83 c4 10             	add    $0x10,%esp
+  interval = atoi(argv[1]);
+  5a:	89 85 40 ff ff ff    	mov    %eax,-0xc0(%ebp)
+  count = argc > 2 ? atoi(argv[2]) : 0;
+  60:	31 c0                	xor    %eax,%eax
+  62:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%ebp)
+  68:	83 ff 03             	cmp    $0x3,%edi
+  6b:	0f 84 86 01 00 00    	je     1f7 <main+0x1f7>
+  if(interval <= 0){
+  71:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%ebp)
+  78:	0f 8e 66 01 00 00    	jle    1e4 <main+0x1e4>
+    printf(2, "vmstat: bad interval\n");
+    exit();
+  }
+  printf(1, "free\tcow\twmap\tpgtbl");
+  7e:	57                   	push   %edi
+  for(i = 0; i < NVMEVENT; i++)
+  7f:	31 db                	xor    %ebx,%ebx
+  printf(1, "free\tcow\twmap\tpgtbl");
+  81:	57                   	push   %edi
+  82:	68 37 10 00 00       	push   $0x1037
+  87:	6a 01                	push   $0x1
+  89:	e8 a2 05 00 00       	call   630 <printf>
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "\t%s", names[i]);
+  98:	83 ec 04             	sub    $0x4,%esp
+  9b:	ff 34 9d 00 20 00 00 	push   0x2000(,%ebx,4)
+  for(i = 0; i < NVMEVENT; i++)
+  a2:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "\t%s", names[i]);
+  a5:	68 4b 10 00 00       	push   $0x104b
+  aa:	6a 01                	push   $0x1
+  ac:	e8 7f 05 00 00       	call   630 <printf>
+  for(i = 0; i < NVMEVENT; i++)
+  b1:	83 c4 10             	add    $0x10,%esp
+  b4:	83 fb 0d             	cmp    $0xd,%ebx
+  b7:	75 df                	jne    98 <main+0x98>
+  printf(1, "\n");
+  b9:	53                   	push   %ebx
+  ba:	53                   	push   %ebx
+  bb:	68 1f 10 00 00       	push   $0x101f
+  c0:	6a 01                	push   $0x1
+  c2:	e8 69 05 00 00       	call   630 <printf>
+  for(n = 0; count == 0 || n < count; n++){
+  c7:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+  cd:	83 c4 10             	add    $0x10,%esp
+  d0:	85 d2                	test   %edx,%edx
+  d2:	0f 94 85 3b ff ff ff 	sete   -0xc5(%ebp)
+  d9:	0f 88 b7 00 00 00    	js     196 <main+0x196>
+  df:	31 c9                	xor    %ecx,%ecx
+    old = new;
+    sleep(interval);
+    snapshot(&new);
+  e1:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  for(n = 0; count == 0 || n < count; n++){
+  e4:	89 8d 44 ff ff ff    	mov    %ecx,-0xbc(%ebp)
+  ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sleep(interval);
+  f0:	83 ec 0c             	sub    $0xc,%esp
+    old = new;
+  f3:	b9 14 00 00 00       	mov    $0x14,%ecx
+  f8:	8d bd 48 ff ff ff    	lea    -0xb8(%ebp),%edi
+  fe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    sleep(interval);
+ 100:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+    snapshot(&new);
+ 106:	89 de                	mov    %ebx,%esi
+    printf(1, "%d\t%d\t%d\t%d", new.free, new.cowshared, new.wmap,
+           new.pgtable);
+    for(i = 0; i < NVMEVENT; i++)
+ 108:	31 ff                	xor    %edi,%edi
+    sleep(interval);
+ 10a:	e8 14 04 00 00       	call   523 <sleep>
+    snapshot(&new);
+ 10f:	89 1c 24             	mov    %ebx,(%esp)
+ 112:	e8 f9 00 00 00       	call   210 <snapshot>
+    printf(1, "%d\t%d\t%d\t%d", new.free, new.cowshared, new.wmap,
+ 117:	58                   	pop    %eax
+ 118:	5a                   	pop    %edx
+ 119:	ff 75 b0             	push   -0x50(%ebp)
+ 11c:	ff 75 ac             	push   -0x54(%ebp)
+ 11f:	ff 75 a8             	push   -0x58(%ebp)
+ 122:	ff 75 a4             	push   -0x5c(%ebp)
+ 125:	68 4f 10 00 00       	push   $0x104f
+ 12a:	6a 01                	push   $0x1
+ 12c:	e8 ff 04 00 00       	call   630 <printf>
+ 131:	83 c4 20             	add    $0x20,%esp
+ 134:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "\t%d", new.event[i] - old.event[i]);
+ 138:	8b 44 bb 1c          	mov    0x1c(%ebx,%edi,4),%eax
+ 13c:	83 ec 04             	sub    $0x4,%esp
+ 13f:	2b 84 bd 64 ff ff ff 	sub    -0x9c(%ebp,%edi,4),%eax
+    for(i = 0; i < NVMEVENT; i++)
+ 146:	83 c7 01             	add    $0x1,%edi
+      printf(1, "\t%d", new.event[i] - old.event[i]);
+ 149:	50                   	push   %eax
+ 14a:	68 57 10 00 00       	push   $0x1057
+ 14f:	6a 01                	push   $0x1
+ 151:	e8 da 04 00 00       	call   630 <printf>
+    for(i = 0; i < NVMEVENT; i++)
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	83 ff 0d             	cmp    $0xd,%edi
+ 15c:	75 da                	jne    138 <main+0x138>
+    printf(1, "\n");
+ 15e:	83 ec 08             	sub    $0x8,%esp
+ 161:	68 1f 10 00 00       	push   $0x101f
+ 166:	6a 01                	push   $0x1
+ 168:	e8 c3 04 00 00       	call   630 <printf>
+  for(n = 0; count == 0 || n < count; n++){
+ 16d:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%ebp)
+ 174:	83 c4 10             	add    $0x10,%esp
+ 177:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+ 17d:	39 85 3c ff ff ff    	cmp    %eax,-0xc4(%ebp)
+ 183:	0f 8f 67 ff ff ff    	jg     f0 <main+0xf0>
+ 189:	80 bd 3b ff ff ff 00 	cmpb   $0x0,-0xc5(%ebp)
+ 190:	0f 85 5a ff ff ff    	jne    f0 <main+0xf0>
+    exit();
+ 196:	e8 f8 02 00 00       	call   493 <exit>
+    printf(1, "free %d\ncowshared %d\nwmap %d\npgtable %d\n",
+ 19b:	50                   	push   %eax
+    for(i = 0; i < NVMEVENT; i++)
+ 19c:	31 db                	xor    %ebx,%ebx
+    printf(1, "free %d\ncowshared %d\nwmap %d\npgtable %d\n",
+ 19e:	50                   	push   %eax
+ 19f:	ff 75 b0             	push   -0x50(%ebp)
+ 1a2:	ff 75 ac             	push   -0x54(%ebp)
+ 1a5:	ff 75 a8             	push   -0x58(%ebp)
+ 1a8:	ff 75 a4             	push   -0x5c(%ebp)
+ 1ab:	68 d4 10 00 00       	push   $0x10d4
+ 1b0:	6a 01                	push   $0x1
+ 1b2:	e8 79 04 00 00       	call   630 <printf>
+ 1b7:	83 c4 20             	add    $0x20,%esp
+ 1ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      printf(1, "%s %d\n", names[i], new.event[i]);
+ 1c0:	ff 74 9e 1c          	push   0x1c(%esi,%ebx,4)
+ 1c4:	ff 34 9d 00 20 00 00 	push   0x2000(,%ebx,4)
+    for(i = 0; i < NVMEVENT; i++)
+ 1cb:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "%s %d\n", names[i], new.event[i]);
+ 1ce:	68 1a 10 00 00       	push   $0x101a
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	e8 56 04 00 00       	call   630 <printf>
+    for(i = 0; i < NVMEVENT; i++)
+ 1da:	83 c4 10             	add    $0x10,%esp
+ 1dd:	83 fb 0d             	cmp    $0xd,%ebx
+ 1e0:	75 de                	jne    1c0 <main+0x1c0>
+ 1e2:	eb b2                	jmp    196 <main+0x196>
+    printf(2, "vmstat: bad interval\n");
+ 1e4:	50                   	push   %eax
+ 1e5:	50                   	push   %eax
+ 1e6:	68 21 10 00 00       	push   $0x1021
+ 1eb:	6a 02                	push   $0x2
+ 1ed:	e8 3e 04 00 00       	call   630 <printf>
+    exit();
+ 1f2:	e8 9c 02 00 00       	call   493 <exit>
+  count = argc > 2 ? atoi(argv[2]) : 0;
+ 1f7:	83 ec 0c             	sub    $0xc,%esp
+ 1fa:	ff 73 08             	push   0x8(%ebx)
+ 1fd:	e8 1e 02 00 00       	call   420 <atoi>
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%ebp)
+ 20b:	e9 61 fe ff ff       	jmp    71 <main+0x71>
+
+00000210 <snapshot>:
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	83 ec 0c             	sub    $0xc,%esp
+ 217:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(getvmstat(vs, sizeof(*vs)) < 0 || vs->version < VMSTAT_VERSION){
+ 21a:	6a 50                	push   $0x50
+ 21c:	53                   	push   %ebx
+ 21d:	e8 41 03 00 00       	call   563 <getvmstat>
+ 222:	83 c4 10             	add    $0x10,%esp
+ 225:	85 c0                	test   %eax,%eax
+ 227:	78 0a                	js     233 <snapshot+0x23>
+ 229:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 22c:	7e 05                	jle    233 <snapshot+0x23>
+}
+ 22e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 231:	c9                   	leave
+ 232:	c3                   	ret
+    printf(2, "vmstat: getvmstat failed\n");
+ 233:	50                   	push   %eax
+ 234:	50                   	push   %eax
+ 235:	68 00 10 00 00       	push   $0x1000
+ 23a:	6a 02                	push   $0x2
+ 23c:	e8 ef 03 00 00       	call   630 <printf>
+    exit();
+ 241:	e8 4d 02 00 00       	call   493 <exit>
+ 246:	66 90                	xchg   %ax,%ax
+ 248:	66 90                	xchg   %ax,%ax
+ 24a:	66 90                	xchg   %ax,%ax
+ 24c:	66 90                	xchg   %ax,%ax
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+ 287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 28a:	0f b6 02             	movzbl (%edx),%eax
+ 28d:	84 c0                	test   %al,%al
+ 28f:	75 17                	jne    2a8 <strcmp+0x28>
+ 291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+ 2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2ab:	38 c3                	cmp    %al,%bl
+ 2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2af:	29 d8                	sub    %ebx,%eax
+}
+ 2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b4:	c9                   	leave
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2c4:	31 c0                	xor    %eax,%eax
+ 2c6:	29 d8                	sub    %ebx,%eax
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	eb db                	jmp    2af <strcmp+0x2f>
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e9:	74 15                	je     300 <strlen+0x20>
+ 2eb:	31 c0                	xor    %eax,%eax
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f7:	89 c1                	mov    %eax,%ecx
+ 2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2fb:	89 c8                	mov    %ecx,%eax
+ 2fd:	5d                   	pop    %ebp
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 300:	31 c9                	xor    %ecx,%ecx
+}
+ 302:	5d                   	pop    %ebp
+ 303:	89 c8                	mov    %ecx,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31d:	89 d7                	mov    %edx,%edi
+ 31f:	fc                   	cld
+ 320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 33a:	0f b6 10             	movzbl (%eax),%edx
+ 33d:	84 d2                	test   %dl,%dl
+ 33f:	75 12                	jne    353 <strchr+0x23>
+ 341:	eb 1d                	jmp    360 <strchr+0x30>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 34c:	83 c0 01             	add    $0x1,%eax
+ 34f:	84 d2                	test   %dl,%dl
+ 351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+ 353:	38 d1                	cmp    %dl,%cl
+ 355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 360:	31 c0                	xor    %eax,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 379:	31 db                	xor    %ebx,%ebx
+{
+ 37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 37e:	eb 27                	jmp    3a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 380:	83 ec 04             	sub    $0x4,%esp
+ 383:	6a 01                	push   $0x1
+ 385:	56                   	push   %esi
+ 386:	6a 00                	push   $0x0
+ 388:	e8 1e 01 00 00       	call   4ab <read>
+    if(cc < 1)
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7e 1d                	jle    3b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 394:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 39f:	3c 0a                	cmp    $0xa,%al
+ 3a1:	74 10                	je     3b3 <gets+0x43>
+ 3a3:	3c 0d                	cmp    $0xd,%al
+ 3a5:	74 0c                	je     3b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3a7:	89 df                	mov    %ebx,%edi
+ 3a9:	83 c3 01             	add    $0x1,%ebx
+ 3ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3af:	7c cf                	jl     380 <gets+0x10>
+ 3b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5f                   	pop    %edi
+ 3c0:	5d                   	pop    %ebp
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3d5:	83 ec 08             	sub    $0x8,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 f1 00 00 00       	call   4d3 <open>
+  if(fd < 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	ff 75 0c             	push   0xc(%ebp)
+ 3ef:	89 c3                	mov    %eax,%ebx
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 f4 00 00 00       	call   4eb <fstat>
+  close(fd);
+ 3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3fc:	e8 ba 00 00 00       	call   4bb <close>
+  return r;
+ 401:	83 c4 10             	add    $0x10,%esp
+}
+ 404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 407:	89 f0                	mov    %esi,%eax
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 415:	eb ed                	jmp    404 <stat+0x34>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 427:	0f be 02             	movsbl (%edx),%eax
+ 42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 435:	77 1e                	ja     455 <atoi+0x35>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 02             	movsbl (%edx),%eax
+ 44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+ 455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 458:	89 c8                	mov    %ecx,%eax
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7e 13                	jle    485 <memmove+0x25>
+ 472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 474:	89 d7                	mov    %edx,%edi
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 481:	39 f8                	cmp    %edi,%eax
+ 483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+ 485:	5e                   	pop    %esi
+ 486:	89 d0                	mov    %edx,%eax
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+
+0000048b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 48b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <exit>:
+SYSCALL(exit)
+ 493:	b8 02 00 00 00       	mov    $0x2,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <wait>:
+SYSCALL(wait)
+ 49b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <pipe>:
+SYSCALL(pipe)
+ 4a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <read>:
+SYSCALL(read)
+ 4ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <write>:
+SYSCALL(write)
+ 4b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <close>:
+SYSCALL(close)
+ 4bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <kill>:
+SYSCALL(kill)
+ 4c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <exec>:
+SYSCALL(exec)
+ 4cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <open>:
+SYSCALL(open)
+ 4d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mknod>:
+SYSCALL(mknod)
+ 4db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <unlink>:
+SYSCALL(unlink)
+ 4e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <fstat>:
+SYSCALL(fstat)
+ 4eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <link>:
+SYSCALL(link)
+ 4f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mkdir>:
+SYSCALL(mkdir)
+ 4fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <chdir>:
+SYSCALL(chdir)
+ 503:	b8 09 00 00 00       	mov    $0x9,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <dup>:
+SYSCALL(dup)
+ 50b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <getpid>:
+SYSCALL(getpid)
+ 513:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <sbrk>:
+SYSCALL(sbrk)
+ 51b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <sleep>:
+SYSCALL(sleep)
+ 523:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <uptime>:
+SYSCALL(uptime)
+ 52b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <wmap>:
+SYSCALL(wmap)
+ 533:	b8 16 00 00 00       	mov    $0x16,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <wunmap>:
+SYSCALL(wunmap)
+ 53b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <va2pa>:
+SYSCALL(va2pa)
+ 543:	b8 18 00 00 00       	mov    $0x18,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 54b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <getwssinfo>:
+SYSCALL(getwssinfo)
+ 553:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <setmergeable>:
+SYSCALL(setmergeable)
+ 55b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getvmstat>:
+SYSCALL(getvmstat)
+ 563:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <getfaulthist>:
+SYSCALL(getfaulthist)
+ 56b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <getprocinfo>:
+SYSCALL(getprocinfo)
+ 573:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <spawn>:
+SYSCALL(spawn)
+ 57b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <fsync>:
+SYSCALL(fsync)
+ 583:	b8 20 00 00 00       	mov    $0x20,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+ 58b:	66 90                	xchg   %ax,%ax
+ 58d:	66 90                	xchg   %ax,%ax
+ 58f:	90                   	nop
+
+00000590 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 598:	89 d1                	mov    %edx,%ecx
+{
+ 59a:	83 ec 3c             	sub    $0x3c,%esp
+ 59d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5a0:	85 d2                	test   %edx,%edx
+ 5a2:	0f 89 80 00 00 00    	jns    628 <printint+0x98>
+ 5a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ac:	74 7a                	je     628 <printint+0x98>
+    x = -xx;
+ 5ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5b8:	31 f6                	xor    %esi,%esi
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5c0:	89 c8                	mov    %ecx,%eax
+ 5c2:	31 d2                	xor    %edx,%edx
+ 5c4:	89 f7                	mov    %esi,%edi
+ 5c6:	f7 f3                	div    %ebx
+ 5c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5cb:	0f b6 92 5c 11 00 00 	movzbl 0x115c(%edx),%edx
+ 5d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5d6:	89 ca                	mov    %ecx,%edx
+ 5d8:	89 c1                	mov    %eax,%ecx
+ 5da:	39 da                	cmp    %ebx,%edx
+ 5dc:	73 e2                	jae    5c0 <printint+0x30>
+  if(neg)
+ 5de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5e1:	85 c0                	test   %eax,%eax
+ 5e3:	74 07                	je     5ec <printint+0x5c>
+    buf[i++] = '-';
+ 5e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ea:	89 f7                	mov    %esi,%edi
+ 5ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5f2:	01 df                	add    %ebx,%edi
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 601:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 604:	6a 01                	push   $0x1
+ 606:	50                   	push   %eax
+ 607:	56                   	push   %esi
+ 608:	e8 a6 fe ff ff       	call   4b3 <write>
+  while(--i >= 0)
+ 60d:	89 f8                	mov    %edi,%eax
+ 60f:	83 c4 10             	add    $0x10,%esp
+ 612:	83 ef 01             	sub    $0x1,%edi
+ 615:	39 d8                	cmp    %ebx,%eax
+ 617:	75 df                	jne    5f8 <printint+0x68>
+}
+ 619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 61c:	5b                   	pop    %ebx
+ 61d:	5e                   	pop    %esi
+ 61e:	5f                   	pop    %edi
+ 61f:	5d                   	pop    %ebp
+ 620:	c3                   	ret
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 628:	31 c0                	xor    %eax,%eax
+ 62a:	eb 89                	jmp    5b5 <printint+0x25>
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 639:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 63c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 63f:	0f b6 1e             	movzbl (%esi),%ebx
+ 642:	83 c6 01             	add    $0x1,%esi
+ 645:	84 db                	test   %bl,%bl
+ 647:	74 67                	je     6b0 <printf+0x80>
+ 649:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 64c:	31 d2                	xor    %edx,%edx
+ 64e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 651:	eb 34                	jmp    687 <printf+0x57>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 65b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 660:	83 f8 25             	cmp    $0x25,%eax
+ 663:	74 18                	je     67d <printf+0x4d>
+  write(fd, &c, 1);
+ 665:	83 ec 04             	sub    $0x4,%esp
+ 668:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 66b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66e:	6a 01                	push   $0x1
+ 670:	50                   	push   %eax
+ 671:	57                   	push   %edi
+ 672:	e8 3c fe ff ff       	call   4b3 <write>
+ 677:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 67a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 67d:	0f b6 1e             	movzbl (%esi),%ebx
+ 680:	83 c6 01             	add    $0x1,%esi
+ 683:	84 db                	test   %bl,%bl
+ 685:	74 29                	je     6b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 687:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 68a:	85 d2                	test   %edx,%edx
+ 68c:	74 ca                	je     658 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 68e:	83 fa 25             	cmp    $0x25,%edx
+ 691:	75 ea                	jne    67d <printf+0x4d>
+      if(c == 'd'){
+ 693:	83 f8 25             	cmp    $0x25,%eax
+ 696:	0f 84 24 01 00 00    	je     7c0 <printf+0x190>
+ 69c:	83 e8 63             	sub    $0x63,%eax
+ 69f:	83 f8 15             	cmp    $0x15,%eax
+ 6a2:	77 1c                	ja     6c0 <printf+0x90>
+ 6a4:	ff 24 85 04 11 00 00 	jmp    *0x1104(,%eax,4)
+ 6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b3:	5b                   	pop    %ebx
+ 6b4:	5e                   	pop    %esi
+ 6b5:	5f                   	pop    %edi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+ 6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ca:	6a 01                	push   $0x1
+ 6cc:	52                   	push   %edx
+ 6cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6d0:	57                   	push   %edi
+ 6d1:	e8 dd fd ff ff       	call   4b3 <write>
+ 6d6:	83 c4 0c             	add    $0xc,%esp
+ 6d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6dc:	6a 01                	push   $0x1
+ 6de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6e1:	52                   	push   %edx
+ 6e2:	57                   	push   %edi
+ 6e3:	e8 cb fd ff ff       	call   4b3 <write>
+        putc(fd, c);
+ 6e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6eb:	31 d2                	xor    %edx,%edx
+ 6ed:	eb 8e                	jmp    67d <printf+0x4d>
+ 6ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6fb:	8b 13                	mov    (%ebx),%edx
+ 6fd:	6a 00                	push   $0x0
+ 6ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 701:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 704:	e8 87 fe ff ff       	call   590 <printint>
+        ap++;
+ 709:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 70c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 67 ff ff ff       	jmp    67d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 720:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 723:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 725:	83 c0 04             	add    $0x4,%eax
+ 728:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 72b:	85 db                	test   %ebx,%ebx
+ 72d:	0f 84 9d 00 00 00    	je     7d0 <printf+0x1a0>
+        while(*s != 0){
+ 733:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 736:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 738:	84 c0                	test   %al,%al
+ 73a:	0f 84 3d ff ff ff    	je     67d <printf+0x4d>
+ 740:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 743:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 746:	89 de                	mov    %ebx,%esi
+ 748:	89 d3                	mov    %edx,%ebx
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 756:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	53                   	push   %ebx
+ 75c:	57                   	push   %edi
+ 75d:	e8 51 fd ff ff       	call   4b3 <write>
+        while(*s != 0){
+ 762:	0f b6 06             	movzbl (%esi),%eax
+ 765:	83 c4 10             	add    $0x10,%esp
+ 768:	84 c0                	test   %al,%al
+ 76a:	75 e4                	jne    750 <printf+0x120>
+      state = 0;
+ 76c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 76f:	31 d2                	xor    %edx,%edx
+ 771:	e9 07 ff ff ff       	jmp    67d <printf+0x4d>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 01                	push   $0x1
+ 78f:	e9 6b ff ff ff       	jmp    6ff <printf+0xcf>
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 798:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	52                   	push   %edx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 01 fd ff ff       	call   4b3 <write>
+        ap++;
+ 7b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7b8:	31 d2                	xor    %edx,%edx
+ 7ba:	e9 be fe ff ff       	jmp    67d <printf+0x4d>
+ 7bf:	90                   	nop
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	e9 11 ff ff ff       	jmp    6e1 <printf+0xb1>
+ 7d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7d5:	bb fd 10 00 00       	mov    $0x10fd,%ebx
+ 7da:	e9 61 ff ff ff       	jmp    740 <printf+0x110>
+ 7df:	90                   	nop
+
+000007e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	a1 34 20 00 00       	mov    0x2034,%eax
+{
+ 7e6:	89 e5                	mov    %esp,%ebp
+ 7e8:	57                   	push   %edi
+ 7e9:	56                   	push   %esi
+ 7ea:	53                   	push   %ebx
+ 7eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7fc:	39 ca                	cmp    %ecx,%edx
+ 7fe:	73 30                	jae    830 <free+0x50>
+ 800:	39 c1                	cmp    %eax,%ecx
+ 802:	72 04                	jb     808 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 804:	39 c2                	cmp    %eax,%edx
+ 806:	72 f0                	jb     7f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 808:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 80b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 80e:	39 f8                	cmp    %edi,%eax
+ 810:	74 2e                	je     840 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 812:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 815:	8b 42 04             	mov    0x4(%edx),%eax
+ 818:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 81b:	39 f1                	cmp    %esi,%ecx
+ 81d:	74 38                	je     857 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 81f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 821:	5b                   	pop    %ebx
+  freep = p;
+ 822:	89 15 34 20 00 00    	mov    %edx,0x2034
+}
+ 828:	5e                   	pop    %esi
+ 829:	5f                   	pop    %edi
+ 82a:	5d                   	pop    %ebp
+ 82b:	c3                   	ret
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 830:	39 c1                	cmp    %eax,%ecx
+ 832:	72 d0                	jb     804 <free+0x24>
+ 834:	eb c2                	jmp    7f8 <free+0x18>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 840:	03 70 04             	add    0x4(%eax),%esi
+ 843:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 846:	8b 02                	mov    (%edx),%eax
+ 848:	8b 00                	mov    (%eax),%eax
+ 84a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 84d:	8b 42 04             	mov    0x4(%edx),%eax
+ 850:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 853:	39 f1                	cmp    %esi,%ecx
+ 855:	75 c8                	jne    81f <free+0x3f>
+    p->s.size += bp->s.size;
+ 857:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 85a:	89 15 34 20 00 00    	mov    %edx,0x2034
+    p->s.size += bp->s.size;
+ 860:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 863:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 866:	89 0a                	mov    %ecx,(%edx)
+}
+ 868:	5b                   	pop    %ebx
+ 869:	5e                   	pop    %esi
+ 86a:	5f                   	pop    %edi
+ 86b:	5d                   	pop    %ebp
+ 86c:	c3                   	ret
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000870 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 879:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 87c:	8b 15 34 20 00 00    	mov    0x2034,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 882:	8d 78 07             	lea    0x7(%eax),%edi
+ 885:	c1 ef 03             	shr    $0x3,%edi
+ 888:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 88b:	85 d2                	test   %edx,%edx
+ 88d:	0f 84 8d 00 00 00    	je     920 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 893:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 895:	8b 48 04             	mov    0x4(%eax),%ecx
+ 898:	39 f9                	cmp    %edi,%ecx
+ 89a:	73 64                	jae    900 <malloc+0x90>
+  if(nu < 4096)
+ 89c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8a1:	39 df                	cmp    %ebx,%edi
+ 8a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8ad:	eb 0a                	jmp    8b9 <malloc+0x49>
+ 8af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8b5:	39 f9                	cmp    %edi,%ecx
+ 8b7:	73 47                	jae    900 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8b9:	89 c2                	mov    %eax,%edx
+ 8bb:	39 05 34 20 00 00    	cmp    %eax,0x2034
+ 8c1:	75 ed                	jne    8b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	56                   	push   %esi
+ 8c7:	e8 4f fc ff ff       	call   51b <sbrk>
+  if(p == (char*)-1)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+ 8cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8d2:	74 1c                	je     8f0 <malloc+0x80>
+  hp->s.size = nu;
+ 8d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8d7:	83 ec 0c             	sub    $0xc,%esp
+ 8da:	83 c0 08             	add    $0x8,%eax
+ 8dd:	50                   	push   %eax
+ 8de:	e8 fd fe ff ff       	call   7e0 <free>
+  return freep;
+ 8e3:	8b 15 34 20 00 00    	mov    0x2034,%edx
+      if((p = morecore(nunits)) == 0)
+ 8e9:	83 c4 10             	add    $0x10,%esp
+ 8ec:	85 d2                	test   %edx,%edx
+ 8ee:	75 c0                	jne    8b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8f3:	31 c0                	xor    %eax,%eax
+}
+ 8f5:	5b                   	pop    %ebx
+ 8f6:	5e                   	pop    %esi
+ 8f7:	5f                   	pop    %edi
+ 8f8:	5d                   	pop    %ebp
+ 8f9:	c3                   	ret
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 900:	39 cf                	cmp    %ecx,%edi
+ 902:	74 4c                	je     950 <malloc+0xe0>
+        p->s.size -= nunits;
+ 904:	29 f9                	sub    %edi,%ecx
+ 906:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 909:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 90c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 90f:	89 15 34 20 00 00    	mov    %edx,0x2034
+}
+ 915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 918:	83 c0 08             	add    $0x8,%eax
+}
+ 91b:	5b                   	pop    %ebx
+ 91c:	5e                   	pop    %esi
+ 91d:	5f                   	pop    %edi
+ 91e:	5d                   	pop    %ebp
+ 91f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 920:	c7 05 34 20 00 00 38 	movl   $0x2038,0x2034
+ 927:	20 00 00 
+    base.s.size = 0;
+ 92a:	b8 38 20 00 00       	mov    $0x2038,%eax
+    base.s.ptr = freep = prevp = &base;
+ 92f:	c7 05 38 20 00 00 38 	movl   $0x2038,0x2038
+ 936:	20 00 00 
+    base.s.size = 0;
+ 939:	c7 05 3c 20 00 00 00 	movl   $0x0,0x203c
+ 940:	00 00 00 
+    if(p->s.size >= nunits){
+ 943:	e9 54 ff ff ff       	jmp    89c <malloc+0x2c>
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 950:	8b 08                	mov    (%eax),%ecx
+ 952:	89 0a                	mov    %ecx,(%edx)
+ 954:	eb b9                	jmp    90f <malloc+0x9f>
@@ -0,0 +1,76 @@
+// Print virtual memory statistics. With an interval in ticks,
+// print the free page and COW mapping counts and the number of each
+// event during the interval, count times (forever if count is 0).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "vmstat.h"
+
+char *names[NVMEVENT] = {
+[VM_KALLOC]   "alloc",
+[VM_KFREE]    "freed",
+[VM_FAULT]    "fault",
+[VM_COWCOPY]  "cowcopy",
+[VM_COWREUSE] "cowreuse",
+[VM_LAZYANON] "anon",
+[VM_LAZYFILE] "file",
+[VM_SEGV]     "segv",
+[VM_COPYUVM]  "forkcow",
+[VM_WUNMAP]   "unmap",
+[VM_SWAPIN]   "swapin",
+[VM_SWAPOUT]  "swapout",
+[VM_KSMMERGE] "ksm",
+};
+
+void
+snapshot(struct vmstat *vs)
+{
+  // A newer kernel only adds fields at the end.
+  if(getvmstat(vs, sizeof(*vs)) < 0 || vs->version < VMSTAT_VERSION){
+    printf(2, "vmstat: getvmstat failed\n");
+    exit();
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  struct vmstat old, new;
+  int i, interval, count, n;
+
+  if(argc > 3){
+    printf(2, "usage: vmstat [interval [count]]\n");
+    exit();
+  }
+  snapshot(&new);
+  if(argc < 2){
+    printf(1, "free %d\ncowshared %d\nwmap %d\npgtable %d\n",
+           new.free, new.cowshared, new.wmap, new.pgtable);
+    for(i = 0; i < NVMEVENT; i++)
+      printf(1, "%s %d\n", names[i], new.event[i]);
+    exit();
+  }
+
+  interval = atoi(argv[1]);
+  count = argc > 2 ? atoi(argv[2]) : 0;
+  if(interval <= 0){
+    printf(2, "vmstat: bad interval\n");
+    exit();
+  }
+  printf(1, "free\tcow\twmap\tpgtbl");
+  for(i = 0; i < NVMEVENT; i++)
+    printf(1, "\t%s", names[i]);
+  printf(1, "\n");
+  for(n = 0; count == 0 || n < count; n++){
+    old = new;
+    sleep(interval);
+    snapshot(&new);
+    printf(1, "%d\t%d\t%d\t%d", new.free, new.cowshared, new.wmap,
+           new.pgtable);
+    for(i = 0; i < NVMEVENT; i++)
+      printf(1, "\t%d", new.event[i] - old.event[i]);
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -0,0 +1,43 @@
+// Virtual memory statistics, for `getvmstat`.
+// Bump VMSTAT_VERSION when the layout of struct vmstat changes;
+// fields are only ever added at the end.
+#define VMSTAT_VERSION 2
+
+// Events counted since boot (struct vmstat's event[]).
+#define VM_KALLOC    0   // pages allocated
+#define VM_KFREE     1   // pages freed
+#define VM_FAULT     2   // page faults
+#define VM_COWCOPY   3   // COW faults that copied the page
+#define VM_COWREUSE  4   // COW faults on a page no longer shared
+#define VM_LAZYANON  5   // anonymous wmap pages filled on fault
+#define VM_LAZYFILE  6   // file-backed wmap pages read on fault
+#define VM_SEGV      7   // faults that killed the process
+#define VM_COPYUVM   8   // pages shared COW by fork
+#define VM_WUNMAP    9   // pages unmapped by wunmap
+#define VM_SWAPIN    10  // pages swapped in
+#define VM_SWAPOUT   11  // pages swapped out
+#define VM_KSMMERGE  12  // pages merged into a shared frame by KSM
+#define NVMEVENT     13
+
+// Page fault latency classes, for `getfaulthist`.
+#define FAULT_COW    0   // COW copy
+#define FAULT_ANON   1   // anonymous wmap fill
+#define FAULT_FILE   2   // file-backed wmap read
+#define FAULT_SWAPIN 3   // swap-in
+#define NFAULTCLASS  4
+#define NFAULTBUCKET 32  // bucket i: faults taking [2^i, 2^(i+1)) cycles
+
+struct faulthist {
+    uint count[NFAULTCLASS][NFAULTBUCKET];
+};
+
+struct vmstat {
+    int version;                        // VMSTAT_VERSION
+    int size;                           // Bytes filled in by the kernel
+    uint ticks;                         // When the snapshot was taken
+    uint free;                          // Free pages
+    uint cowshared;                     // User PTEs sharing a page copy-on-write
+    uint wmap;                          // Pages loaded in wmap regions
+    uint pgtable;                       // Page directory and page table pages
+    uint event[NVMEVENT];               // Event counts, indexed by VM_*
+};
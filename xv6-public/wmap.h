@@ -16,3 +16,26 @@ struct wmapinfo {
     int n_loaded_pages[MAX_WMMAP_INFO]; // Number of pages physically loaded into memory
 };
 
+// for `getwssinfo`
+struct wssinfo {
+    int period;                         // Ticks between working-set scans
+    int rss;                            // Resident user pages
+    int wss;                            // Pages accessed during the last period
+    int age[4];                         // Resident pages by periods since last access (3 means 3 or more)
+    int hot[MAX_WMMAP_INFO];            // Pages of each wmap region accessed during the last period
+};
+
+// for `getprocinfo`
+struct procinfo {
+    int pid;
+    int ppid;                           // Parent's pid, or 0
+    char state[8];                      // "sleep", "run", ...
+    char name[16];
+    uint sz;                            // Size of the process image in bytes
+    int rss;                            // Resident user pages (image and wmap regions)
+    int shared;                         // ... whose frame is also mapped elsewhere
+    int private;                        // ... mapped only here
+    int wmap;                           // ... in wmap regions
+    int pgtable;                        // Page directory and page-table pages
+    uint ticks;                         // Timer ticks spent running
+};
@@ -0,0 +1,93 @@
+// Working-set estimation from the hardware accessed bit.
+//
+// Every WSSPERIOD ticks the timer interrupt on CPU 0 calls
+// wssscan(), which visits the resident user pages of each
+// process (its image and its wmap regions) and folds PTE_A into
+// a 2-bit age kept in the PTE (PTE_AGE): an accessed page gets
+// age 0 and PTE_A is cleared, any other page ages by one, up to
+// MAXAGE. The per-process counts of pages at each age, and the
+// number of recently used pages in each wmap region, are kept
+// for getwssinfo(). The swapper's clock (swap.c) uses the same
+// aging step, so it prefers pages that have gone unused longest.
+//
+// Processes running on another CPU are skipped: clearing PTE_A
+// under a running CPU could race with it setting PTE_D, and a
+// stale TLB entry would hide further accesses anyway. Such a
+// process keeps the counts from its last scan.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+
+extern pte_t* walkpgdir(pde_t *pgdir, const void *va, int alloc);
+
+// Fold the accessed bit of the present PTE into its age and
+// return the new age. The caller must flush the TLB before the
+// page's next access is expected to set PTE_A again.
+int
+agepage(pte_t *pte)
+{
+  uint age;
+
+  if(*pte & PTE_A)
+    age = 0;
+  else if((age = PTEAGE(*pte)) < MAXAGE)
+    age++;
+  *pte = (*pte & ~(PTE_A|PTE_AGE)) | (age << 10);
+  return age;
+}
+
+// Age the present user pages in [start, end) and count them by
+// age in hist. Returns the number of pages with age 0.
+static int
+scanrange(pde_t *pgdir, uint start, uint end, int *hist)
+{
+  pte_t *pte;
+  uint va;
+  int age, hot;
+
+  hot = 0;
+  for(va = PGROUNDDOWN(start); va < end; va += PGSIZE){
+    if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0){
+      va = PGADDR(PDX(va) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+      continue;
+    age = agepage(pte);
+    hist[age]++;
+    if(age == 0)
+      hot++;
+  }
+  return hot;
+}
+
+void
+wssscan(void)
+{
+  struct proc *p;
+  struct mmap *m;
+  int i, hist[MAXAGE+1];
+
+  lockptable();
+  for(i = 0; i < NPROC; i++){
+    p = procslot(i);
+    if(p->pgdir == 0 || p->pid == 0)
+      continue;
+    if(p->state != SLEEPING && p->state != RUNNABLE && p != myproc())
+      continue;
+    memset(hist, 0, sizeof(hist));
+    scanrange(p->pgdir, 0, p->sz, hist);
+    for(m = p->mmaps; m < &p->mmaps[MAX_WMMAP_INFO]; m++)
+      if(m->addr != -1)
+        m->hot = scanrange(p->pgdir, m->addr, m->addr + m->length, hist);
+    memmove(p->pgage, hist, sizeof(hist));
+  }
+  if(myproc())
+    lcr3(V2P(myproc()->pgdir));
+  unlockptable();
+}
@@ -9,6 +9,15 @@ inb(ushort port)
   return data;
 }
 
+static inline uint
+inl(ushort port)
+{
+  uint data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
 static inline void
 insl(int port, void *addr, int cnt)
 {
@@ -30,6 +39,12 @@ outw(ushort port, ushort data)
   asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline void
+outl(ushort port, uint data)
+{
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+}
+
 static inline void
 outsl(int port, const void *addr, int cnt)
 {
@@ -130,6 +145,17 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Low 32 bits of the time-stamp counter; differences of
+// readings less than a wrap apart are still right.
+static inline uint
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -0,0 +1,301 @@
+// Compressed in-memory tier in front of the swap area.
+//
+// When swap.c evicts an anonymous page it first offers the page
+// here. An all-zero page is recorded as a token and takes no
+// space; any other page is compressed with a small LZ77 codec
+// and kept in the pool if the result is at most ZMAXLEN bytes.
+// Pages that do not compress well, or that do not fit in the
+// pool, go to disk as before. On a swap-in the slot is looked up
+// here first, so disk is only read for pages that missed.
+//
+// The pool is made of whole pages, each holding at most two
+// compressed pages: one packed at the start and one at the end
+// (as in Linux's zbud). That bounds the ratio at 2:1 but makes
+// placement and freeing trivial.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "fs.h"
+
+#define NSWAPSLOT (SWAPSIZE/(PGSIZE/BSIZE))
+#define ZMAXPAGES 512                // pool size limit, in pages
+#define ZMAXLEN   (PGSIZE*3/4)       // largest compressed page kept
+
+#define LZHASHBITS 12
+#define LZWINDOW   4096              // offsets fit in 12 bits
+#define LZMINLEN   3
+#define LZMAXLEN   (LZMINLEN + 15)   // lengths fit in 4 bits
+
+// Where a slot's data is.
+#define ZNONE  0                     // not here; on disk
+#define ZZERO  1                     // all zeroes
+#define ZFIRST 2                     // start of pool page
+#define ZLAST  3                     // end of pool page
+
+struct zpage {
+  char *mem;                         // 0 if not allocated
+  ushort first;                      // bytes used at the start
+  ushort last;                       // bytes used at the end
+};
+
+struct zslot {
+  uchar where;
+  ushort page;                       // index in zswap.page
+  ushort len;                        // compressed length
+};
+
+struct {
+  struct spinlock lock;
+  struct zpage page[ZMAXPAGES];
+  struct zslot slot[NSWAPSLOT];
+  uint npage;                        // pool pages allocated
+  uint nstored;                      // compressed pages in the pool
+  uint nzero;                        // zero-page tokens
+  uint bytes;                        // compressed bytes in the pool
+  uint nreject;                      // pages that didn't compress
+  uint nfull;                        // pages that didn't fit
+  uint nhit;                         // swap-ins served from memory
+  uint nmiss;                        // swap-ins read from disk
+} zswap;
+
+// Compression scratch space. Only the reclaimer compresses,
+// and there is one at a time (swap.c's reclaimlock).
+static ushort lzhash[1<<LZHASHBITS];
+static uchar zbuf[ZMAXLEN];
+
+void
+zswapinit(void)
+{
+  initlock(&zswap.lock, "zswap");
+}
+
+static uint
+lzhashof(uchar *p)
+{
+  uint v = p[0] | (p[1] << 8) | (p[2] << 16);
+  return (v * 2654435761U) >> (32 - LZHASHBITS);
+}
+
+// Compress the page src into dst, which has room for max bytes.
+// The output is a sequence of groups: a control byte whose bits,
+// low first, say whether each of the next (up to) 8 items is a
+// literal byte (0) or a 2-byte back reference (1) holding a
+// 12-bit offset and a 4-bit length. Returns the compressed
+// length, or -1 if it would exceed max.
+static int
+lzcompress(uchar *src, uchar *dst, int max)
+{
+  int ip, op, ctl, bit, len, off;
+  uint h, ref;
+
+  memset(lzhash, 0, sizeof(lzhash));
+  ip = op = 0;
+  while(ip < PGSIZE){
+    if(op + 1 + 8*2 > max)
+      return -1;
+    ctl = op++;
+    dst[ctl] = 0;
+    for(bit = 0; bit < 8 && ip < PGSIZE; bit++){
+      len = 0;
+      if(ip + LZMINLEN <= PGSIZE){
+        h = lzhashof(src + ip);
+        ref = lzhash[h];
+        lzhash[h] = ip + 1;
+        if(ref && ip - (ref - 1) < LZWINDOW){
+          ref--;
+          while(len < LZMAXLEN && ip + len < PGSIZE &&
+                src[ref + len] == src[ip + len])
+            len++;
+        }
+      }
+      if(len >= LZMINLEN){
+        off = ip - ref;
+        dst[op++] = off & 0xff;
+        dst[op++] = ((off >> 8) & 0x0f) | ((len - LZMINLEN) << 4);
+        dst[ctl] |= 1 << bit;
+        ip += len;
+      } else {
+        dst[op++] = src[ip++];
+      }
+    }
+  }
+  return op;
+}
+
+// Expand n bytes of lzcompress() output into the page dst.
+static void
+lzdecompress(uchar *src, int n, uchar *dst)
+{
+  int ip, op, ctl, bit, len, off;
+
+  ip = op = 0;
+  while(ip < n){
+    ctl = src[ip++];
+    for(bit = 0; bit < 8 && ip < n; bit++){
+      if(ctl & (1 << bit)){
+        off = src[ip] | ((src[ip+1] & 0x0f) << 8);
+        len = (src[ip+1] >> 4) + LZMINLEN;
+        ip += 2;
+        if(off == 0 || off > op || op + len > PGSIZE)
+          panic("lzdecompress");
+        // Byte at a time: the source may overlap the output.
+        for(; len > 0; len--, op++)
+          dst[op] = dst[op - off];
+      } else {
+        if(op >= PGSIZE)
+          panic("lzdecompress");
+        dst[op++] = src[ip++];
+      }
+    }
+  }
+  if(op != PGSIZE)
+    panic("lzdecompress: short");
+}
+
+static int
+iszero(char *page)
+{
+  uint *p;
+
+  for(p = (uint*)page; p < (uint*)(page + PGSIZE); p++)
+    if(*p)
+      return 0;
+  return 1;
+}
+
+// Keep a copy of page for swap slot. Returns 0 if it is kept
+// here, -1 if it has to go to disk.
+int
+zswapstore(uint slot, char *page)
+{
+  struct zslot *z = &zswap.slot[slot];
+  struct zpage *zp, *fit;
+  int n;
+
+  if(iszero(page)){
+    acquire(&zswap.lock);
+    z->where = ZZERO;
+    zswap.nzero++;
+    release(&zswap.lock);
+    return 0;
+  }
+  if((n = lzcompress((uchar*)page, zbuf, ZMAXLEN)) < 0){
+    zswap.nreject++;
+    return -1;
+  }
+
+  // Prefer a page with one free half that fits; else a new page.
+  acquire(&zswap.lock);
+  fit = 0;
+  for(zp = zswap.page; zp < &zswap.page[ZMAXPAGES]; zp++){
+    if(zp->mem == 0){
+      if(fit == 0)
+        fit = zp;
+    } else if((zp->first == 0 || zp->last == 0) &&
+              zp->first + zp->last + n <= PGSIZE){
+      fit = zp;
+      break;
+    }
+  }
+  if(fit && fit->mem == 0){
+    if((fit->mem = kalloc()) == 0)
+      fit = 0;
+    else
+      zswap.npage++;
+  }
+  if(fit == 0){
+    zswap.nfull++;
+    release(&zswap.lock);
+    return -1;
+  }
+  if(fit->first == 0){
+    memmove(fit->mem, zbuf, n);
+    fit->first = n;
+    z->where = ZFIRST;
+  } else {
+    memmove(fit->mem + PGSIZE - n, zbuf, n);
+    fit->last = n;
+    z->where = ZLAST;
+  }
+  z->page = fit - zswap.page;
+  z->len = n;
+  zswap.nstored++;
+  zswap.bytes += n;
+  release(&zswap.lock);
+  return 0;
+}
+
+// Fill page with the contents kept for slot. Returns 0 on a
+// hit, -1 if the slot is not here and has to be read from disk.
+// The caller holds a reference to the slot, so the data cannot
+// be dropped meanwhile, and the pool page holding it stays.
+int
+zswapload(uint slot, char *page)
+{
+  struct zslot *z = &zswap.slot[slot];
+  char *src;
+
+  if(z->where == ZNONE){
+    zswap.nmiss++;
+    return -1;
+  }
+  zswap.nhit++;
+  if(z->where == ZZERO){
+    memset(page, 0, PGSIZE);
+    return 0;
+  }
+  src = zswap.page[z->page].mem;
+  if(z->where == ZLAST)
+    src += PGSIZE - z->len;
+  lzdecompress((uchar*)src, z->len, (uchar*)page);
+  return 0;
+}
+
+// Forget any copy kept for slot, which is no longer in use.
+void
+zswapdrop(uint slot)
+{
+  struct zslot *z = &zswap.slot[slot];
+  struct zpage *zp;
+
+  acquire(&zswap.lock);
+  if(z->where == ZZERO)
+    zswap.nzero--;
+  else if(z->where != ZNONE){
+    zp = &zswap.page[z->page];
+    if(z->where == ZFIRST)
+      zp->first = 0;
+    else
+      zp->last = 0;
+    zswap.nstored--;
+    zswap.bytes -= z->len;
+    if(zp->first == 0 && zp->last == 0){
+      kfree(zp->mem);
+      zp->mem = 0;
+      zswap.npage--;
+    }
+  }
+  z->where = ZNONE;
+  release(&zswap.lock);
+}
+
+// Print pool usage, compression ratio and hit rate.
+// Runs on ^P; no lock to avoid wedging a stuck machine further.
+void
+zswapdump(void)
+{
+  uint ratio, total;
+
+  ratio = zswap.bytes ? zswap.nstored*PGSIZE*100 / zswap.bytes : 0;
+  total = zswap.nhit + zswap.nmiss;
+  cprintf("zswap: %d pages in %d pool pages, %d zero, ratio %d.%d%d\n",
+          zswap.nstored, zswap.npage, zswap.nzero,
+          ratio/100, ratio/10%10, ratio%10);
+  cprintf(" %d rejected, %d pool full, %d hits, %d misses (%d%% hit)\n",
+          zswap.nreject, zswap.nfull, zswap.nhit, zswap.nmiss,
+          total ? zswap.nhit*100/total : 0);
+}